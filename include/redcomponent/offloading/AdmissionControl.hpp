@@ -0,0 +1,207 @@
+/**
+ * @file AdmissionControl.hpp
+ * @brief Target-Side Admission Leases with Latency-Adaptive Limits
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "IOffloadManager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Slot token granting one source the right to offload to a target
+ */
+struct AdmissionLease {
+    uint64_t lease_id = 0;
+    std::string node_id;
+    std::chrono::steady_clock::time_point expires_at;
+};
+
+/**
+ * @brief Admission tuning
+ */
+struct AdmissionOptions {
+    size_t min_limit = 1;                   ///< Limit never drops below this
+    size_t initial_limit = 2;               ///< Starting limit (capped at max_concurrent_offloads)
+    std::chrono::seconds lease_ttl{60};     ///< Leases not renewed within this expire
+    double latency_tolerance = 2.0;         ///< Samples above tolerance x baseline signal overload
+    double decrease_factor = 0.9;           ///< Multiplicative decrease on overload
+    double baseline_drift = 0.01;           ///< Rate the baseline follows rising latency
+};
+
+/**
+ * @brief Admission state of one target node (runs on, or stands in for, the target)
+ *
+ * Grants at most limit() concurrent leases. The limit adapts with AIMD to
+ * the segment latency the target observes: +1/limit per healthy sample up
+ * to max_concurrent_offloads, x decrease_factor when a sample exceeds
+ * latency_tolerance times the baseline (the slowly drifting minimum).
+ * Leases carry a TTL so slots held by crashed sources are reclaimed.
+ * Thread-safe.
+ */
+class TargetAdmission {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    mutable std::mutex mutex_;
+    AdmissionOptions options_;
+    std::string node_id_;
+    size_t max_limit_;
+    double limit_;
+    double baseline_us_ = 0.0;
+    uint64_t next_lease_id_ = 1;
+    std::map<uint64_t, Clock::time_point> leases_;
+    size_t rejected_ = 0;
+
+    void expire(Clock::time_point now) {
+        std::erase_if(leases_, [now](const auto& lease) { return lease.second <= now; });
+    }
+
+public:
+    TargetAdmission(std::string node_id, size_t max_concurrent, const AdmissionOptions& options = {})
+        : options_(options), node_id_(std::move(node_id)),
+          max_limit_(std::max<size_t>(max_concurrent, options.min_limit)),
+          limit_(static_cast<double>(std::clamp(options.initial_limit, options.min_limit,
+                                                max_limit_))) {}
+
+    /**
+     * @brief Request a slot
+     * @return Lease, or nullopt if the target is at its current limit
+     */
+    [[nodiscard]] std::optional<AdmissionLease> try_acquire(Clock::time_point now) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        expire(now);
+        if (leases_.size() >= static_cast<size_t>(limit_)) {
+            rejected_++;
+            return std::nullopt;
+        }
+        AdmissionLease lease{next_lease_id_++, node_id_, now + options_.lease_ttl};
+        leases_[lease.lease_id] = lease.expires_at;
+        return lease;
+    }
+
+    /**
+     * @brief Extend a lease by lease_ttl
+     * @return false if it already expired or was released
+     */
+    bool renew(AdmissionLease& lease, Clock::time_point now) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = leases_.find(lease.lease_id);
+        if (it == leases_.end() || it->second <= now) return false;
+        it->second = lease.expires_at = now + options_.lease_ttl;
+        return true;
+    }
+
+    bool release(uint64_t lease_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return leases_.erase(lease_id) > 0;
+    }
+
+    /**
+     * @brief Feed a segment latency observed on this target
+     */
+    void record_latency(std::chrono::microseconds latency) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        double sample = static_cast<double>(std::max<int64_t>(latency.count(), 1));
+        if (baseline_us_ <= 0.0 || sample < baseline_us_) {
+            baseline_us_ = sample;
+        } else {
+            baseline_us_ += (sample - baseline_us_) * options_.baseline_drift;
+        }
+
+        if (sample > options_.latency_tolerance * baseline_us_) {
+            limit_ = std::max(static_cast<double>(options_.min_limit),
+                              limit_ * options_.decrease_factor);
+        } else {
+            limit_ = std::min(static_cast<double>(max_limit_), limit_ + 1.0 / limit_);
+        }
+    }
+
+    /**
+     * @brief Whether a request at @p now would be granted
+     */
+    [[nodiscard]] bool has_capacity(Clock::time_point now) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t live = static_cast<size_t>(std::count_if(leases_.begin(), leases_.end(),
+            [now](const auto& lease) { return lease.second > now; }));
+        return live < static_cast<size_t>(limit_);
+    }
+
+    [[nodiscard]] size_t limit() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return static_cast<size_t>(limit_);
+    }
+
+    [[nodiscard]] size_t active_leases() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return leases_.size();
+    }
+
+    [[nodiscard]] size_t rejected() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return rejected_;
+    }
+
+    [[nodiscard]] std::chrono::microseconds baseline_latency() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::chrono::microseconds{static_cast<int64_t>(baseline_us_)};
+    }
+};
+
+/**
+ * @brief Admission state of all targets, shared by every source of a cluster
+ *
+ * Stand-in for the per-target admission endpoint: sources that share one
+ * registry see each other's leases, as they would when asking the real
+ * targets. Thread-safe.
+ */
+class AdmissionRegistry {
+private:
+    mutable std::mutex mutex_;
+    AdmissionOptions options_;
+    std::map<std::string, std::unique_ptr<TargetAdmission>> targets_;
+
+public:
+    explicit AdmissionRegistry(const AdmissionOptions& options = {}) : options_(options) {}
+
+    /**
+     * @brief Admission state of @p node (created from max_concurrent_offloads on first use)
+     */
+    TargetAdmission& target(const TargetNode& node) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& entry = targets_[node.node_id];
+        if (!entry) {
+            entry = std::make_unique<TargetAdmission>(
+                node.node_id, node.max_concurrent_offloads, options_);
+        }
+        return *entry;
+    }
+
+    /**
+     * @brief Admission state of a known node, or nullptr
+     */
+    [[nodiscard]] TargetAdmission* find(const std::string& node_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = targets_.find(node_id);
+        return it == targets_.end() ? nullptr : it->second.get();
+    }
+
+    bool release(const AdmissionLease& lease) {
+        auto* target = find(lease.node_id);
+        return target && target->release(lease.lease_id);
+    }
+};
+
+} // namespace redcomponent::offloading
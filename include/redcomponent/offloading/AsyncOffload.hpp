@@ -0,0 +1,440 @@
+/**
+ * @file AsyncOffload.hpp
+ * @brief C++20 Coroutine API for Offload Operations
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "IOffloadManager.hpp"
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+namespace redcomponent::offloading {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Executors
+// ─────────────────────────────────────────────────────────────────────────────
+
+/**
+ * @brief Executor that runs coroutine resumptions
+ *
+ * Manager callbacks may fire while the manager holds its internal lock,
+ * so resumptions are always posted rather than run inline. Executors must
+ * not run posted work synchronously inside post().
+ */
+class IExecutor {
+public:
+    virtual ~IExecutor() = default;
+
+    /**
+     * @brief Schedule @p task to run later on an executor thread
+     */
+    virtual void post(std::function<void()> task) = 0;
+};
+
+/**
+ * @brief FIFO executor drained by the owner's event loop
+ */
+class QueueExecutor : public IExecutor {
+private:
+    std::mutex mutex_;
+    std::deque<std::function<void()>> queue_;
+
+public:
+    void post(std::function<void()> task) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(task));
+    }
+
+    /**
+     * @brief Run queued tasks (including ones they post) until empty
+     * @return Number of tasks run
+     */
+    size_t run_pending() {
+        size_t ran = 0;
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (queue_.empty()) return ran;
+                task = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            task();
+            ++ran;
+        }
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Task
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <typename T>
+class Task;
+
+namespace detail {
+
+struct FinalAwaiter {
+    bool await_ready() noexcept { return false; }
+    template <typename P>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept {
+        auto next = h.promise().continuation;
+        return next ? next : std::noop_coroutine();
+    }
+    void await_resume() noexcept {}
+};
+
+struct TaskPromiseBase {
+    std::coroutine_handle<> continuation;
+    std::exception_ptr error;
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() { error = std::current_exception(); }
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase {
+    std::optional<T> value;
+    Task<T> get_return_object();
+    void return_value(T v) { value = std::move(v); }
+    T take() {
+        if (error) std::rethrow_exception(error);
+        return std::move(*value);
+    }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase {
+    Task<void> get_return_object();
+    void return_void() {}
+    void take() {
+        if (error) std::rethrow_exception(error);
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Lazily started coroutine producing a T
+ *
+ * co_await a Task from another coroutine, or call start() from
+ * non-coroutine code and poll done()/result().
+ */
+template <typename T>
+class Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+public:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() {
+        if (handle_) handle_.destroy();
+    }
+
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+        handle_.promise().continuation = continuation;
+        return handle_;
+    }
+    T await_resume() { return handle_.promise().take(); }
+
+    /**
+     * @brief Start a top-level task (runs until its first suspension)
+     */
+    void start() {
+        if (handle_ && !handle_.done()) handle_.resume();
+    }
+
+    [[nodiscard]] bool done() const { return handle_ && handle_.done(); }
+
+    /**
+     * @brief Get the result of a finished task (rethrows its exception)
+     */
+    T result() { return handle_.promise().take(); }
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() {
+    return Task<T>{std::coroutine_handle<TaskPromise<T>>::from_promise(*this)};
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() {
+    return Task<void>{std::coroutine_handle<TaskPromise<void>>::from_promise(*this)};
+}
+
+} // namespace detail
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Progress Stream
+// ─────────────────────────────────────────────────────────────────────────────
+
+/**
+ * @brief Async generator of progress updates for one offload
+ *
+ * `while (auto p = co_await stream.next()) { ... }` yields updates until
+ * the offload finishes. Updates arriving while nobody is waiting are
+ * coalesced to the latest one, so a slow consumer never backs up the
+ * transfer path.
+ */
+class ProgressStream {
+private:
+    friend class AsyncOffloadManager;
+
+    struct State {
+        std::mutex mutex;
+        IExecutor* executor = nullptr;
+        std::optional<OffloadProgress> pending;
+        bool closed = false;
+        std::coroutine_handle<> waiter;
+        std::optional<OffloadProgress>* slot = nullptr;
+
+        void deliver(std::optional<OffloadProgress> value, bool close) {
+            std::coroutine_handle<> resume;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (closed) return;
+                closed = close;
+                if (waiter) {
+                    *slot = std::move(value);
+                    resume = std::exchange(waiter, {});
+                } else if (value) {
+                    pending = std::move(value);
+                }
+            }
+            if (resume) {
+                executor->post([resume]() { resume.resume(); });
+            }
+        }
+    };
+
+    std::shared_ptr<State> state_;
+
+    explicit ProgressStream(std::shared_ptr<State> state) : state_(std::move(state)) {}
+
+public:
+    class NextAwaiter {
+    private:
+        State& state_;
+        std::optional<OffloadProgress> result_;
+
+    public:
+        explicit NextAwaiter(State& state) : state_(state) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> h) {
+            std::lock_guard<std::mutex> lock(state_.mutex);
+            if (state_.pending) {
+                result_ = std::exchange(state_.pending, std::nullopt);
+                return false;
+            }
+            if (state_.closed) {
+                return false;
+            }
+            state_.waiter = h;
+            state_.slot = &result_;
+            return true;
+        }
+
+        std::optional<OffloadProgress> await_resume() { return std::move(result_); }
+    };
+
+    /**
+     * @brief Await the next update; nullopt once the offload has finished
+     */
+    [[nodiscard]] NextAwaiter next() { return NextAwaiter{*state_}; }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Async Offload Manager
+// ─────────────────────────────────────────────────────────────────────────────
+
+/**
+ * @brief Awaitable facade over an IOffloadManager
+ *
+ * Takes over the manager's on_progress/on_complete/on_error callbacks and
+ * turns them into coroutine resumptions posted to @p executor. Any number
+ * of coroutines may await the same offload; none of them blocks a thread.
+ */
+class AsyncOffloadManager {
+private:
+    struct CompletionWaiter {
+        std::coroutine_handle<> handle;
+        OffloadResult* result;
+    };
+
+    IOffloadManager& manager_;
+    IExecutor& executor_;
+    std::mutex mutex_;
+    std::vector<CompletionWaiter> completion_waiters_;
+    std::vector<std::weak_ptr<ProgressStream::State>> streams_;
+    std::string last_error_;
+
+    void add_completion_waiter(std::coroutine_handle<> h, OffloadResult* result) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        completion_waiters_.push_back({h, result});
+    }
+
+    bool remove_completion_waiter(std::coroutine_handle<> h) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = std::find_if(completion_waiters_.begin(), completion_waiters_.end(),
+            [h](const CompletionWaiter& w) { return w.handle == h; });
+        if (it == completion_waiters_.end()) return false;
+        completion_waiters_.erase(it);
+        return true;
+    }
+
+    std::vector<std::shared_ptr<ProgressStream::State>> live_streams() {
+        std::vector<std::shared_ptr<ProgressStream::State>> live;
+        std::erase_if(streams_, [&live](const auto& weak) {
+            auto state = weak.lock();
+            if (!state) return true;
+            live.push_back(std::move(state));
+            return false;
+        });
+        return live;
+    }
+
+    void handle_progress(const OffloadProgress& progress) {
+        std::vector<std::shared_ptr<ProgressStream::State>> streams;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            streams = live_streams();
+        }
+        for (auto& s : streams) s->deliver(progress, false);
+    }
+
+    void handle_complete(const OffloadResult& result) {
+        std::vector<CompletionWaiter> waiters;
+        std::vector<std::shared_ptr<ProgressStream::State>> streams;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            waiters.swap(completion_waiters_);
+            streams = live_streams();
+            streams_.clear();
+        }
+        for (auto& s : streams) s->deliver(std::nullopt, true);
+        for (auto& w : waiters) {
+            *w.result = result;
+            executor_.post([h = w.handle]() { h.resume(); });
+        }
+    }
+
+public:
+    class OffloadAwaiter {
+    private:
+        AsyncOffloadManager& owner_;
+        std::optional<std::vector<std::string>> data_ids_;
+        OffloadResult result_;
+
+    public:
+        OffloadAwaiter(AsyncOffloadManager& owner,
+                       std::optional<std::vector<std::string>> data_ids)
+            : owner_(owner), data_ids_(std::move(data_ids)) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> h) {
+            owner_.add_completion_waiter(h, &result_);
+            if (!data_ids_) {
+                return true;                // Only wait for completion
+            }
+            if (owner_.manager_.start_offload(*data_ids_)) {
+                return true;
+            }
+            if (!owner_.remove_completion_waiter(h)) {
+                return true;                // A completion already claimed us
+            }
+            std::lock_guard<std::mutex> lock(owner_.mutex_);
+            result_.success = false;
+            result_.error_message = owner_.last_error_.empty()
+                ? std::string("Failed to start offload") : owner_.last_error_;
+            result_.completed_at = std::chrono::steady_clock::now();
+            return false;
+        }
+
+        OffloadResult await_resume() { return std::move(result_); }
+    };
+
+    AsyncOffloadManager(IOffloadManager& manager, IExecutor& executor)
+        : manager_(manager), executor_(executor) {
+        manager_.on_progress([this](const OffloadProgress& p) { handle_progress(p); });
+        manager_.on_complete([this](const OffloadResult& r) { handle_complete(r); });
+        manager_.on_error([this](const std::string& error) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            last_error_ = error;
+        });
+    }
+
+    ~AsyncOffloadManager() {
+        manager_.on_progress(nullptr);
+        manager_.on_complete(nullptr);
+        manager_.on_error(nullptr);
+    }
+
+    AsyncOffloadManager(const AsyncOffloadManager&) = delete;
+    AsyncOffloadManager& operator=(const AsyncOffloadManager&) = delete;
+
+    /**
+     * @brief Start an offload and await its result
+     *
+     * Resolves immediately with success == false if the offload cannot start.
+     */
+    [[nodiscard]] OffloadAwaiter offload_async(std::vector<std::string> data_ids = {}) {
+        return OffloadAwaiter{*this, std::move(data_ids)};
+    }
+
+    /**
+     * @brief Await completion of the offload already in progress
+     */
+    [[nodiscard]] OffloadAwaiter wait_for_completion() {
+        return OffloadAwaiter{*this, std::nullopt};
+    }
+
+    /**
+     * @brief Subscribe to progress of the current or next offload
+     */
+    [[nodiscard]] ProgressStream progress() {
+        auto state = std::make_shared<ProgressStream::State>();
+        state->executor = &executor_;
+        std::lock_guard<std::mutex> lock(mutex_);
+        streams_.push_back(state);
+        return ProgressStream{std::move(state)};
+    }
+
+    /**
+     * @brief Underlying synchronous manager
+     */
+    [[nodiscard]] IOffloadManager& manager() { return manager_; }
+};
+
+} // namespace redcomponent::offloading
@@ -0,0 +1,229 @@
+/**
+ * @file ChangeTracker.hpp
+ * @brief Page-Level Change Tracking for Delta Offloads
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "Checksum.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Pages a delta offload must ship to one target
+ */
+struct DeltaPlan {
+    std::string node_id;                    ///< Target the plan was computed for
+    std::vector<size_t> pages;              ///< Changed page indices, ascending
+    std::vector<uint64_t> generations;      ///< Page generation at plan time (per entry of pages)
+    std::vector<uint64_t> hashes;           ///< Content hash per entry of pages (content plans only)
+    size_t bytes = 0;                       ///< Bytes to transfer
+    size_t total_bytes = 0;                 ///< Size of the tracked data
+    bool full = false;                      ///< No previous offload to this target
+
+    [[nodiscard]] bool empty() const { return pages.empty(); }
+
+    /**
+     * @brief Fraction of the data the delta ships (1.0 = full copy)
+     */
+    [[nodiscard]] double ratio() const {
+        return total_bytes > 0 ? static_cast<double>(bytes) / static_cast<double>(total_bytes)
+                               : 0.0;
+    }
+};
+
+/**
+ * @brief Tracks which pages changed since the last offload to each target
+ *
+ * Two detection modes share one manifest per target node:
+ * - Generations: the write path calls record_write(), which stamps the
+ *   touched pages with a new generation number. plan() selects pages
+ *   whose generation is newer than the one last shipped. O(pages), no I/O.
+ * - Content hashes: plan_by_content() hashes the current data page by
+ *   page and selects pages whose hash differs from the one shipped. Use
+ *   when writes bypass the tracker (restores, external tools).
+ *
+ * A plan snapshots the generations it ships, so writes that land while
+ * the transfer runs keep their pages dirty for the next delta. Call
+ * commit() only after the target acknowledged every page of the plan.
+ * Thread-safe.
+ */
+class ChangeTracker {
+private:
+    struct Manifest {
+        std::vector<uint64_t> generations;  // 0 = never shipped
+        std::vector<uint64_t> hashes;       // 0 = unknown
+    };
+
+    mutable std::mutex mutex_;
+    size_t page_size_;
+    size_t total_bytes_;
+    uint64_t generation_ = 1;
+    std::vector<uint64_t> page_generations_;
+    std::map<std::string, Manifest> manifests_;
+
+    [[nodiscard]] size_t pages_for(size_t bytes) const {
+        return (bytes + page_size_ - 1) / page_size_;
+    }
+
+    [[nodiscard]] size_t page_bytes(size_t page) const {
+        size_t offset = page * page_size_;
+        return std::min(page_size_, total_bytes_ - offset);
+    }
+
+    DeltaPlan begin_plan(const std::string& node_id) const {
+        DeltaPlan plan;
+        plan.node_id = node_id;
+        plan.total_bytes = total_bytes_;
+        plan.full = manifests_.find(node_id) == manifests_.end();
+        return plan;
+    }
+
+    void add_page(DeltaPlan& plan, size_t page) const {
+        plan.pages.push_back(page);
+        plan.generations.push_back(page_generations_[page]);
+        plan.bytes += page_bytes(page);
+    }
+
+public:
+    /**
+     * @brief Construct tracker
+     * @param total_bytes Size of the tracked data (e.g. a shard)
+     * @param page_size Tracking granularity; match OffloadConfig::segment_size
+     */
+    explicit ChangeTracker(size_t total_bytes, size_t page_size = 1 * 1024 * 1024)
+        : page_size_(std::max<size_t>(page_size, 1)), total_bytes_(total_bytes),
+          page_generations_(pages_for(total_bytes), 1) {}
+
+    /**
+     * @brief Record a write of @p length bytes at @p offset
+     */
+    void record_write(uint64_t offset, size_t length) {
+        if (length == 0) return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (offset >= total_bytes_) return;
+        size_t first = static_cast<size_t>(offset / page_size_);
+        size_t last = static_cast<size_t>(
+            std::min<uint64_t>(offset + length - 1, total_bytes_ - 1) / page_size_);
+        uint64_t generation = ++generation_;
+        for (size_t page = first; page <= last; ++page) {
+            page_generations_[page] = generation;
+        }
+    }
+
+    /**
+     * @brief Grow or shrink the tracked data; new pages count as changed
+     */
+    void resize(size_t total_bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t boundary = std::min(total_bytes_, total_bytes);
+        total_bytes_ = total_bytes;
+        uint64_t generation = ++generation_;
+        page_generations_.resize(pages_for(total_bytes), generation);
+
+        // The page holding the shorter end changed length
+        size_t page = boundary / page_size_;
+        if (boundary % page_size_ != 0 && page < page_generations_.size()) {
+            page_generations_[page] = generation;
+        }
+    }
+
+    /**
+     * @brief Changed pages for @p node_id from recorded writes
+     */
+    [[nodiscard]] DeltaPlan plan(const std::string& node_id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        DeltaPlan plan = begin_plan(node_id);
+        auto it = manifests_.find(node_id);
+        for (size_t page = 0; page < page_generations_.size(); ++page) {
+            bool shipped = it != manifests_.end() && page < it->second.generations.size() &&
+                           it->second.generations[page] >= page_generations_[page];
+            if (!shipped) add_page(plan, page);
+        }
+        return plan;
+    }
+
+    /**
+     * @brief Changed pages for @p node_id by comparing content hashes
+     * @param data Current contents (total_bytes() long)
+     */
+    [[nodiscard]] DeltaPlan plan_by_content(const std::string& node_id,
+                                            std::span<const std::byte> data) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        DeltaPlan plan = begin_plan(node_id);
+        auto it = manifests_.find(node_id);
+        size_t pages = std::min(page_generations_.size(), pages_for(data.size()));
+        for (size_t page = 0; page < pages; ++page) {
+            size_t offset = page * page_size_;
+            uint64_t hash = content_hash64(
+                data.subspan(offset, std::min(page_size_, data.size() - offset)));
+            bool shipped = it != manifests_.end() && page < it->second.hashes.size() &&
+                           it->second.hashes[page] == hash;
+            if (!shipped) {
+                add_page(plan, page);
+                plan.hashes.push_back(hash);
+            }
+        }
+        return plan;
+    }
+
+    /**
+     * @brief Record that every page of @p plan reached its target
+     */
+    void commit(const DeltaPlan& plan) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Manifest& manifest = manifests_[plan.node_id];
+        manifest.generations.resize(page_generations_.size(), 0);
+        manifest.hashes.resize(page_generations_.size(), 0);
+        for (size_t i = 0; i < plan.pages.size(); ++i) {
+            size_t page = plan.pages[i];
+            if (page >= page_generations_.size()) continue;
+            manifest.generations[page] = std::max(manifest.generations[page], plan.generations[i]);
+            manifest.hashes[page] = i < plan.hashes.size() ? plan.hashes[i] : 0;
+        }
+    }
+
+    /**
+     * @brief Drop the manifest of a target (its next offload is full)
+     */
+    void forget(const std::string& node_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        manifests_.erase(node_id);
+    }
+
+    [[nodiscard]] bool has_manifest(const std::string& node_id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return manifests_.count(node_id) > 0;
+    }
+
+    [[nodiscard]] size_t page_size() const { return page_size_; }
+
+    [[nodiscard]] size_t page_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return page_generations_.size();
+    }
+
+    [[nodiscard]] size_t total_bytes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return total_bytes_;
+    }
+
+    /**
+     * @brief Byte offset of @p page
+     */
+    [[nodiscard]] uint64_t page_offset(size_t page) const {
+        return static_cast<uint64_t>(page) * page_size_;
+    }
+};
+
+} // namespace redcomponent::offloading
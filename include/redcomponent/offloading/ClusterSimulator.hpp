@@ -0,0 +1,394 @@
+/**
+ * @file ClusterSimulator.hpp
+ * @brief Deterministic Discrete-Event Cluster Simulator on MockOffloadManager
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "MockOffloadManager.hpp"
+#include "OffloadPolicy.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <numbers>
+#include <optional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Virtual time since the start of a simulation
+ */
+using SimTime = std::chrono::microseconds;
+
+/**
+ * @brief Memory demand of the local node over virtual time (percent)
+ */
+class LoadCurve {
+private:
+    std::function<double(SimTime)> fn_;
+
+public:
+    LoadCurve() : fn_([](SimTime) { return 0.0; }) {}
+    explicit LoadCurve(std::function<double(SimTime)> fn) : fn_(std::move(fn)) {}
+
+    [[nodiscard]] double operator()(SimTime t) const { return fn_(t); }
+
+    /**
+     * @brief Constant demand
+     */
+    [[nodiscard]] static LoadCurve constant(double percent) {
+        return LoadCurve{[percent](SimTime) { return percent; }};
+    }
+
+    /**
+     * @brief Sinusoidal daily pattern peaking at @p peak_at within each period
+     */
+    [[nodiscard]] static LoadCurve diurnal(double base, double amplitude,
+                                           SimTime peak_at = std::chrono::hours{14},
+                                           SimTime period = std::chrono::hours{24}) {
+        return LoadCurve{[=](SimTime t) {
+            double phase = static_cast<double>((t - peak_at).count()) /
+                           static_cast<double>(period.count());
+            return base + amplitude * std::cos(2.0 * std::numbers::pi * phase);
+        }};
+    }
+
+    /**
+     * @brief Linear growth of @p percent_per_day on top of this curve
+     */
+    [[nodiscard]] LoadCurve with_growth(double percent_per_day) const {
+        return LoadCurve{[inner = fn_, percent_per_day](SimTime t) {
+            return inner(t) + percent_per_day * static_cast<double>(t.count()) / 86400e6;
+        }};
+    }
+};
+
+/**
+ * @brief Simulation parameters
+ */
+struct SimulationConfig {
+    SimTime sample_interval = std::chrono::seconds{10};   ///< Load sampling / auto-trigger period
+    size_t local_memory_bytes = 16ULL * 1024 * 1024 * 1024; ///< Memory freed per offloaded byte is relative to this
+    double local_storage_percent = 0.0;     ///< Storage utilization of the local node
+    double segment_failure_rate = 0.0;      ///< Probability a segment transfer fails
+    uint64_t seed = 1;                      ///< RNG seed (same seed, same run)
+};
+
+/**
+ * @brief Aggregate outcome of a simulation run
+ */
+struct SimulationReport {
+    SimTime simulated{0};                   ///< Virtual time covered
+    size_t samples = 0;                     ///< Load samples taken
+    size_t offloads_triggered = 0;          ///< Auto-trigger decisions that started an offload
+    size_t offloads_succeeded = 0;
+    size_t offloads_failed = 0;
+    size_t selection_failures = 0;          ///< Triggers with no eligible target
+    size_t segments_transferred = 0;
+    size_t segment_failures = 0;            ///< Failed segment attempts
+    size_t segment_retries = 0;             ///< Retries scheduled
+    size_t bytes_offloaded = 0;
+    double peak_memory_percent = 0.0;
+    SimTime time_above_threshold{0};        ///< Sampled time at or above the memory threshold
+    std::map<std::string, size_t> bytes_per_node;
+};
+
+/**
+ * @brief Discrete-event simulator driving MockOffloadManager in virtual time
+ *
+ * Events are ordered by (virtual time, insertion order) and draw from one
+ * seeded RNG, so a run is fully reproducible. The mock's clock is replaced
+ * with the virtual clock for the simulator's lifetime; target selection
+ * (auto_select_target_node with the simulator's topology), the auto-trigger
+ * thresholds and the retry schedule (OffloadPolicy) are the real code paths.
+ *
+ * Each offload moves the mock's fixed payload segment by segment, each
+ * segment taking its share of TopologyModel::expected_transfer_time.
+ * Successful offloads relieve local memory by bytes / local_memory_bytes.
+ */
+class ClusterSimulator {
+private:
+    struct Event {
+        SimTime at;
+        uint64_t seq;
+        std::function<void()> action;
+
+        bool operator>(const Event& other) const {
+            return at != other.at ? at > other.at : seq > other.seq;
+        }
+    };
+
+    struct ActiveOffload {
+        std::string node_id;
+        size_t segment_bytes = 0;
+        size_t segments_total = 0;
+        size_t segments_done = 0;
+        size_t attempts = 0;
+        SimTime segment_time{1};
+    };
+
+    MockOffloadManager& manager_;
+    SimulationConfig sim_;
+    const std::chrono::steady_clock::time_point epoch_ = std::chrono::steady_clock::now();
+    SimTime now_{0};
+    uint64_t next_seq_ = 0;
+    std::priority_queue<Event, std::vector<Event>, std::greater<>> events_;
+    std::mt19937_64 rng_;
+    LoadCurve load_;
+    std::vector<TargetNode> nodes_;
+    NodeLocation local_location_;
+    std::optional<ActiveOffload> active_;
+    double relief_percent_ = 0.0;
+    bool sampling_ = false;
+    SimulationReport report_;
+
+    [[nodiscard]] double uniform() {
+        return static_cast<double>(rng_() >> 11) * 0x1.0p-53;
+    }
+
+    TargetNode* find_node(const std::string& node_id) {
+        for (auto& node : nodes_) {
+            if (node.node_id == node_id) return &node;
+        }
+        return nullptr;
+    }
+
+    void publish_nodes() {
+        manager_.set_available_nodes(nodes_);
+    }
+
+    void sample() {
+        OffloadConfig config = manager_.get_config();
+        ResourceSample usage{memory_percent(), sim_.local_storage_percent};
+
+        report_.samples++;
+        report_.peak_memory_percent = std::max(report_.peak_memory_percent,
+                                               usage.memory_usage_percent);
+        if (usage.memory_usage_percent >= config.memory_threshold_percent) {
+            report_.time_above_threshold += sim_.sample_interval;
+        }
+        if (!active_ && OffloadPolicy::should_trigger(usage, config)) {
+            begin_offload(config);
+        }
+        schedule_after(sim_.sample_interval, [this] { sample(); });
+    }
+
+    void begin_offload(const OffloadConfig& config) {
+        publish_nodes();
+        if (!manager_.auto_select_target_node()) {
+            report_.selection_failures++;
+            return;
+        }
+        auto target = manager_.get_current_target();
+        if (!target || !manager_.start_offload()) {
+            report_.selection_failures++;
+            return;
+        }
+        report_.offloads_triggered++;
+
+        OffloadProgress progress = manager_.get_progress();
+        ActiveOffload offload;
+        offload.node_id = target->node_id;
+        offload.segments_total = std::max<size_t>(progress.segments_total, 1);
+        offload.segment_bytes = progress.total_bytes / offload.segments_total;
+        auto total_time = manager_.get_topology().expected_transfer_time(
+            local_location_, *target, progress.total_bytes, config);
+        offload.segment_time = std::max(
+            SimTime{1}, total_time / static_cast<int64_t>(offload.segments_total));
+        active_ = offload;
+
+        if (auto* node = find_node(offload.node_id)) {
+            node->active_offload_count++;
+        }
+        schedule_after(offload.segment_time, [this] { segment_done(); });
+    }
+
+    void segment_done() {
+        if (!active_) return;
+        OffloadConfig config = manager_.get_config();
+        auto& offload = *active_;
+
+        const TargetNode* node = find_node(offload.node_id);
+        bool failed = !node || node->health != NodeHealth::Healthy ||
+                      uniform() < sim_.segment_failure_rate;
+        if (failed) {
+            report_.segment_failures++;
+            offload.attempts++;
+            if (!OffloadPolicy::may_retry(offload.attempts - 1, config)) {
+                manager_.simulate_error("Segment " + std::to_string(offload.segments_done) +
+                                        " failed after " +
+                                        std::to_string(offload.attempts - 1) + " retries");
+                finish_offload(false);
+                return;
+            }
+            report_.segment_retries++;
+            manager_.simulate_segment_retry();
+            schedule_after(OffloadPolicy::retry_delay(offload.attempts, config) +
+                           offload.segment_time, [this] { segment_done(); });
+            return;
+        }
+
+        offload.attempts = 0;
+        offload.segments_done++;
+        report_.segments_transferred++;
+        manager_.simulate_progress(offload.segment_bytes, epoch_ + now_);
+        if (offload.segments_done == offload.segments_total) {
+            manager_.simulate_complete(true);
+            finish_offload(true);
+            return;
+        }
+        schedule_after(offload.segment_time, [this] { segment_done(); });
+    }
+
+    void finish_offload(bool success) {
+        auto offload = *active_;
+        active_.reset();
+        size_t bytes = offload.segment_bytes * offload.segments_total;
+
+        if (auto* node = find_node(offload.node_id)) {
+            if (node->active_offload_count > 0) node->active_offload_count--;
+            if (success) {
+                node->available_storage_bytes -= std::min(node->available_storage_bytes, bytes);
+                node->used_storage_bytes += bytes;
+                node->last_successful_offload = epoch_ + now_;
+            }
+        }
+        if (success) {
+            report_.offloads_succeeded++;
+            report_.bytes_offloaded += bytes;
+            report_.bytes_per_node[offload.node_id] += bytes;
+            if (sim_.local_memory_bytes > 0) {
+                relief_percent_ += 100.0 * static_cast<double>(bytes) /
+                                   static_cast<double>(sim_.local_memory_bytes);
+            }
+        } else {
+            report_.offloads_failed++;
+        }
+
+        // Ready the mock for the next trigger
+        manager_.force_status(OffloadStatus::Idle);
+        manager_.clear_target_selection();
+        publish_nodes();
+    }
+
+public:
+    /**
+     * @brief Construct simulator
+     * @param manager Mock driven by the simulation (its clock becomes virtual)
+     * @param config Simulation parameters
+     */
+    explicit ClusterSimulator(MockOffloadManager& manager, SimulationConfig config = {})
+        : manager_(manager), sim_(config), rng_(config.seed) {
+        manager_.set_clock([this] { return epoch_ + now_; });
+        manager_.clear_nodes();
+    }
+
+    ~ClusterSimulator() {
+        manager_.set_clock(nullptr);
+    }
+
+    ClusterSimulator(const ClusterSimulator&) = delete;
+    ClusterSimulator& operator=(const ClusterSimulator&) = delete;
+
+    /**
+     * @brief Set location of the simulated source node
+     */
+    void set_local_location(const NodeLocation& location) {
+        local_location_ = location;
+        manager_.set_local_location(location);
+    }
+
+    /**
+     * @brief Add a target node, optionally with a measured link
+     */
+    void add_node(const TargetNode& node, std::optional<LinkMetrics> link = std::nullopt) {
+        nodes_.push_back(node);
+        if (link) {
+            TopologyModel topology = manager_.get_topology();
+            topology.set_node_link(node.node_id, *link);
+            manager_.set_topology(topology);
+        }
+        publish_nodes();
+    }
+
+    /**
+     * @brief Set memory demand of the local node
+     */
+    void set_load_curve(LoadCurve curve) {
+        load_ = std::move(curve);
+    }
+
+    /**
+     * @brief Change a node's health at virtual time @p at
+     */
+    void set_node_health_at(SimTime at, const std::string& node_id, NodeHealth health) {
+        schedule_at(at, [this, node_id, health] {
+            if (auto* node = find_node(node_id)) {
+                node->health = health;
+                publish_nodes();
+            }
+        });
+    }
+
+    /**
+     * @brief Take a node down during [from, to)
+     */
+    void fail_node(SimTime from, SimTime to, const std::string& node_id) {
+        set_node_health_at(from, node_id, NodeHealth::Unhealthy);
+        set_node_health_at(to, node_id, NodeHealth::Healthy);
+    }
+
+    /**
+     * @brief Schedule an arbitrary action at virtual time @p at
+     */
+    void schedule_at(SimTime at, std::function<void()> action) {
+        events_.push(Event{std::max(at, now_), next_seq_++, std::move(action)});
+    }
+
+    void schedule_after(SimTime delay, std::function<void()> action) {
+        schedule_at(now_ + delay, std::move(action));
+    }
+
+    /**
+     * @brief Process all events up to @p duration of additional virtual time
+     * @return Cumulative report
+     */
+    SimulationReport run_for(SimTime duration) {
+        if (!sampling_) {
+            sampling_ = true;
+            schedule_at(now_, [this] { sample(); });
+        }
+        SimTime end = now_ + duration;
+        while (!events_.empty() && events_.top().at <= end) {
+            Event event = events_.top();
+            events_.pop();
+            now_ = event.at;
+            event.action();
+        }
+        now_ = end;
+        report_.simulated = now_;
+        return report_;
+    }
+
+    /**
+     * @brief Local memory utilization after relief from completed offloads
+     */
+    [[nodiscard]] double memory_percent() const {
+        return std::max(0.0, load_(now_) - relief_percent_);
+    }
+
+    [[nodiscard]] SimTime now() const { return now_; }
+    [[nodiscard]] bool offload_active() const { return active_.has_value(); }
+    [[nodiscard]] const std::vector<TargetNode>& nodes() const { return nodes_; }
+    [[nodiscard]] const SimulationReport& report() const { return report_; }
+};
+
+} // namespace redcomponent::offloading
@@ -0,0 +1,327 @@
+/**
+ * @file ConnectionPool.hpp
+ * @brief Per-Node Connection Pool with Keep-Alive and Multiplexed Streams
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "Transport.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Creates an unconnected transport to a node
+ */
+using TransportFactory = std::function<std::unique_ptr<ITransport>(const TargetNode&)>;
+
+/**
+ * @brief Connection pool tuning
+ */
+struct ConnectionPoolOptions {
+    size_t max_connections_per_node = 4;
+    size_t max_streams_per_connection = 8;      ///< Concurrent senders sharing one connection
+    std::chrono::seconds idle_timeout{60};      ///< Idle connections are closed after this
+    std::chrono::seconds keepalive_interval{15}; ///< Idle connections are probed this often
+};
+
+/**
+ * @brief Connection pool counters
+ */
+struct ConnectionPoolStats {
+    size_t connects = 0;            ///< Handshakes for new connections
+    size_t reuses = 0;              ///< Streams opened on an existing connection
+    size_t reconnects = 0;          ///< Handshakes re-establishing a dropped connection
+    size_t idle_closed = 0;         ///< Connections closed by maintain()
+    size_t keepalive_probes = 0;
+    size_t rejected = 0;            ///< open_stream() calls with every slot busy
+};
+
+/**
+ * @brief Shares warm connections to each target between offloads
+ *
+ * A connection carries up to max_streams_per_connection streams; each
+ * stream sends whole segments and the connection serializes them, so
+ * concurrent offloads and proxy forwards interleave at segment
+ * granularity without a handshake each. New connections are opened only
+ * when every existing one is at its stream limit. maintain(), run
+ * periodically, probes idle connections every keepalive_interval
+ * (re-establishing dropped ones off the send path) and closes those idle
+ * past idle_timeout. Handshakes happen outside the pool lock.
+ * Thread-safe.
+ */
+class ConnectionPool {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct Connection {
+        TargetNode node;
+        std::unique_ptr<ITransport> transport;
+        std::mutex io;                          // Serializes the transport
+        std::atomic<bool> broken{false};
+        size_t streams = 0;                     // Guarded by the pool mutex
+        Clock::time_point last_used;
+        Clock::time_point last_probe;
+    };
+
+    mutable std::mutex mutex_;
+    TransportFactory factory_;
+    ConnectionPoolOptions options_;
+    std::function<Clock::time_point()> clock_;
+    std::map<std::string, std::vector<std::shared_ptr<Connection>>> connections_;
+    ConnectionPoolStats stats_;
+
+    void release(const std::shared_ptr<Connection>& connection) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        connection->streams--;
+        connection->last_used = clock_();
+    }
+
+    void discard(const std::shared_ptr<Connection>& connection) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::erase(connections_[connection->node.node_id], connection);
+    }
+
+public:
+    /**
+     * @brief One sender's share of a pooled connection (releases on destruction)
+     */
+    class Stream {
+    private:
+        ConnectionPool* pool_ = nullptr;
+        std::shared_ptr<Connection> connection_;
+
+        friend class ConnectionPool;
+        Stream(ConnectionPool* pool, std::shared_ptr<Connection> connection)
+            : pool_(pool), connection_(std::move(connection)) {}
+
+    public:
+        Stream(Stream&& other) noexcept
+            : pool_(std::exchange(other.pool_, nullptr)), connection_(std::move(other.connection_)) {}
+
+        Stream& operator=(Stream&& other) noexcept {
+            if (this != &other) {
+                close();
+                pool_ = std::exchange(other.pool_, nullptr);
+                connection_ = std::move(other.connection_);
+            }
+            return *this;
+        }
+
+        Stream(const Stream&) = delete;
+        Stream& operator=(const Stream&) = delete;
+
+        ~Stream() { close(); }
+
+        /**
+         * @brief Send a segment over the shared connection
+         */
+        TransportStatus send_segment(uint64_t segment_id, std::span<const std::byte> payload,
+                                     uint32_t checksum) {
+            if (!connection_) return TransportStatus::NotConnected;
+            std::lock_guard<std::mutex> lock(connection_->io);
+            if (connection_->broken || !connection_->transport->is_connected()) {
+                connection_->broken = true;
+                return TransportStatus::NotConnected;
+            }
+            auto status = connection_->transport->send_segment(segment_id, payload, checksum);
+            if (status == TransportStatus::ConnectionReset ||
+                status == TransportStatus::NotConnected) {
+                connection_->broken = true;
+            }
+            return status;
+        }
+
+        /**
+         * @brief Whether the underlying connection is usable
+         */
+        [[nodiscard]] bool is_connected() const {
+            return connection_ && !connection_->broken;
+        }
+
+        /**
+         * @brief Return the stream slot to the pool
+         */
+        void close() {
+            if (pool_ && connection_) pool_->release(connection_);
+            pool_ = nullptr;
+            connection_.reset();
+        }
+    };
+
+    /**
+     * @brief Construct pool
+     * @param factory Creates transports for new connections
+     * @param options Tuning
+     * @param clock Time source (injectable for tests)
+     */
+    explicit ConnectionPool(TransportFactory factory, const ConnectionPoolOptions& options = {},
+                            std::function<Clock::time_point()> clock = Clock::now)
+        : factory_(std::move(factory)), options_(options), clock_(std::move(clock)) {}
+
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+    /**
+     * @brief Open a stream to @p node on the least-loaded warm connection
+     * @return nullopt if every connection is at its stream limit or connecting failed
+     */
+    [[nodiscard]] std::optional<Stream> open_stream(const TargetNode& node) {
+        std::shared_ptr<Connection> chosen;
+        std::unique_lock<std::mutex> handshake;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto& pool = connections_[node.node_id];
+            for (const auto& connection : pool) {
+                if (connection->broken || connection->streams >= options_.max_streams_per_connection) {
+                    continue;
+                }
+                if (!chosen || connection->streams < chosen->streams) chosen = connection;
+            }
+
+            if (chosen) {
+                stats_.reuses++;
+            } else if (pool.size() < options_.max_connections_per_node) {
+                chosen = std::make_shared<Connection>();
+                chosen->node = node;
+                chosen->transport = factory_(node);
+                pool.push_back(chosen);
+                stats_.connects++;
+            } else {
+                // Recycle a dropped connection nobody is using
+                for (const auto& connection : pool) {
+                    if (connection->broken && connection->streams == 0) {
+                        chosen = connection;
+                        stats_.reconnects++;
+                        break;
+                    }
+                }
+                if (!chosen) {
+                    stats_.rejected++;
+                    return std::nullopt;
+                }
+            }
+            if (chosen->streams == 0) {
+                // Taken before the pool lock is dropped so sharers wait for the handshake
+                handshake = std::unique_lock<std::mutex>(chosen->io);
+                if (!chosen->broken && chosen->transport->is_connected()) handshake.unlock();
+            }
+            chosen->streams++;
+            chosen->last_used = chosen->last_probe = clock_();
+        }
+
+        if (handshake) {
+            chosen->transport->disconnect();
+            bool connected = chosen->transport->connect(node);
+            chosen->broken = !connected;
+            handshake.unlock();
+            if (!connected) {
+                release(chosen);
+                discard(chosen);
+                return std::nullopt;
+            }
+        }
+        return Stream(this, std::move(chosen));
+    }
+
+    /**
+     * @brief Probe idle connections and close expired ones (call periodically)
+     */
+    void maintain() {
+        std::vector<std::shared_ptr<Connection>> probe;
+        std::vector<std::shared_ptr<Connection>> closing;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto now = clock_();
+            for (auto& [node_id, pool] : connections_) {
+                std::erase_if(pool, [&](const std::shared_ptr<Connection>& connection) {
+                    if (connection->streams > 0) return false;
+                    if (connection->broken || now - connection->last_used >= options_.idle_timeout) {
+                        closing.push_back(connection);
+                        stats_.idle_closed++;
+                        return true;
+                    }
+                    if (now - connection->last_probe >= options_.keepalive_interval) {
+                        connection->last_probe = now;
+                        probe.push_back(connection);
+                        stats_.keepalive_probes++;
+                    }
+                    return false;
+                });
+            }
+        }
+
+        for (const auto& connection : closing) {
+            std::lock_guard<std::mutex> io(connection->io);
+            connection->transport->disconnect();
+        }
+        for (const auto& connection : probe) {
+            std::lock_guard<std::mutex> io(connection->io);
+            if (!connection->transport->is_connected() &&
+                !connection->transport->connect(connection->node)) {
+                connection->broken = true;
+            }
+        }
+    }
+
+    [[nodiscard]] size_t connection_count(const std::string& node_id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = connections_.find(node_id);
+        return it == connections_.end() ? 0 : it->second.size();
+    }
+
+    [[nodiscard]] ConnectionPoolStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+};
+
+/**
+ * @brief ITransport over a pooled stream, for send_with_retry() and pipelines
+ *
+ * connect() opens a stream (reusing a warm connection when possible) and
+ * disconnect() returns it; after a reset, send_with_retry() reconnects
+ * onto a healthy connection of the same pool.
+ */
+class PooledTransport : public ITransport {
+private:
+    ConnectionPool& pool_;
+    std::optional<ConnectionPool::Stream> stream_;
+
+public:
+    explicit PooledTransport(ConnectionPool& pool) : pool_(pool) {}
+
+    bool connect(const TargetNode& node) override {
+        stream_.reset();
+        stream_ = pool_.open_stream(node);
+        return stream_.has_value();
+    }
+
+    void disconnect() override { stream_.reset(); }
+
+    [[nodiscard]] bool is_connected() const override {
+        return stream_ && stream_->is_connected();
+    }
+
+    TransportStatus send_segment(uint64_t segment_id, std::span<const std::byte> payload,
+                                 uint32_t checksum) override {
+        if (!stream_) return TransportStatus::NotConnected;
+        return stream_->send_segment(segment_id, payload, checksum);
+    }
+};
+
+} // namespace redcomponent::offloading
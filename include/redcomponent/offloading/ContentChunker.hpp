@@ -0,0 +1,293 @@
+/**
+ * @file ContentChunker.hpp
+ * @brief Content-Defined Chunking (FastCDC) and Chunk Deduplication
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "IOffloadManager.hpp"
+#include "Checksum.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+namespace detail {
+
+consteval std::array<uint64_t, 256> make_gear_table() {
+    std::array<uint64_t, 256> table{};
+    uint64_t state = 0x243F6A8885A308D3ull;     // splitmix64, fixed seed
+    for (auto& entry : table) {
+        state += 0x9E3779B97F4A7C15ull;
+        uint64_t z = state;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        entry = z ^ (z >> 31);
+    }
+    return table;
+}
+
+inline constexpr auto kGearTable = make_gear_table();
+
+consteval std::array<uint64_t, 256> make_gear_table_shifted() {
+    std::array<uint64_t, 256> table{};
+    for (size_t i = 0; i < 256; ++i) {
+        table[i] = kGearTable[i] << 1;
+    }
+    return table;
+}
+
+inline constexpr auto kGearTableShifted = make_gear_table_shifted();
+
+/**
+ * @brief Mask with @p bits one-bits spread over bits 15..62
+ *
+ * Bit 63 stays clear so the mask survives the one-bit shift used by the
+ * two-bytes-per-step loop.
+ */
+constexpr uint64_t spread_mask(unsigned bits) {
+    uint64_t mask = 0;
+    bits = std::clamp(bits, 1u, 48u);
+    for (unsigned i = 0; i < bits; ++i) {
+        mask |= 1ull << (62 - i * 48 / bits);
+    }
+    return mask;
+}
+
+} // namespace detail
+
+/**
+ * @brief Chunk size bounds for ContentChunker
+ */
+struct ChunkerOptions {
+    size_t min_size = 16 * 1024;            ///< No cut point before this many bytes
+    size_t avg_size = 64 * 1024;            ///< Expected chunk size (rounded to a power of two)
+    size_t max_size = 256 * 1024;           ///< Forced cut point
+
+    /**
+     * @brief Bounds that keep every chunk within one transfer segment
+     */
+    [[nodiscard]] static ChunkerOptions for_config(const OffloadConfig& config) {
+        ChunkerOptions options;
+        options.max_size = std::max<size_t>(config.segment_size, 4096);
+        options.avg_size = options.max_size / 4;
+        options.min_size = options.max_size / 16;
+        return options;
+    }
+};
+
+/**
+ * @brief 128-bit chunk fingerprint (two independently seeded 64-bit hashes)
+ */
+struct ChunkFingerprint {
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+
+    [[nodiscard]] static ChunkFingerprint of(std::span<const std::byte> data) {
+        return {content_hash64(data, 0x5EED0001ull), content_hash64(data, 0x5EED0002ull)};
+    }
+
+    bool operator==(const ChunkFingerprint&) const = default;
+};
+
+struct ChunkFingerprintHash {
+    size_t operator()(const ChunkFingerprint& fp) const noexcept {
+        return static_cast<size_t>(fp.lo ^ (fp.hi * 0x9E3779B97F4A7C15ull));
+    }
+};
+
+/**
+ * @brief One content-defined chunk of a buffer
+ */
+struct Chunk {
+    uint64_t offset = 0;
+    uint32_t size = 0;
+    ChunkFingerprint fingerprint;
+};
+
+/**
+ * @brief FastCDC content-defined chunker
+ *
+ * Cut points depend only on the preceding bytes (Gear rolling hash), so
+ * inserting or removing data shifts at most the chunks around the edit
+ * and later chunks keep their fingerprints. Uses normalized chunking
+ * (a stricter mask before avg_size, a looser one after) and rolls two
+ * bytes per step with a pre-shifted Gear table, which yields the same
+ * cut points as the byte-wise loop.
+ */
+class ContentChunker {
+private:
+    ChunkerOptions options_;
+    uint64_t mask_small_;           // Before avg_size: harder to match
+    uint64_t mask_large_;           // After avg_size: easier to match
+
+public:
+    explicit ContentChunker(const ChunkerOptions& options = {}) : options_(options) {
+        options_.avg_size = std::bit_ceil(std::max<size_t>(options_.avg_size, 64));
+        options_.min_size = std::min(options_.min_size, options_.avg_size);
+        options_.max_size = std::max(options_.max_size, options_.avg_size);
+        auto bits = static_cast<unsigned>(std::bit_width(options_.avg_size) - 1);
+        mask_small_ = detail::spread_mask(bits + 2);
+        mask_large_ = detail::spread_mask(bits > 2 ? bits - 2 : 1);
+    }
+
+    [[nodiscard]] const ChunkerOptions& options() const { return options_; }
+
+    /**
+     * @brief Length of the first chunk of @p data
+     */
+    [[nodiscard]] size_t next_boundary(std::span<const std::byte> data) const {
+        const auto* p = reinterpret_cast<const unsigned char*>(data.data());
+        size_t n = std::min(data.size(), options_.max_size);
+        if (n <= options_.min_size) return n;
+        size_t normal = std::min(options_.avg_size, n);
+
+        const auto& gear = detail::kGearTable;
+        const auto& gear_ls = detail::kGearTableShifted;
+        const uint64_t small_ls = mask_small_ << 1;
+        const uint64_t large_ls = mask_large_ << 1;
+
+        uint64_t h = 0;
+        size_t i = options_.min_size;
+        for (; i + 2 <= normal; i += 2) {
+            h = (h << 2) + gear_ls[p[i]];
+            if (!(h & small_ls)) return i + 1;
+            h += gear[p[i + 1]];
+            if (!(h & mask_small_)) return i + 2;
+        }
+        for (; i < normal; ++i) {
+            h = (h << 1) + gear[p[i]];
+            if (!(h & mask_small_)) return i + 1;
+        }
+        for (; i + 2 <= n; i += 2) {
+            h = (h << 2) + gear_ls[p[i]];
+            if (!(h & large_ls)) return i + 1;
+            h += gear[p[i + 1]];
+            if (!(h & mask_large_)) return i + 2;
+        }
+        for (; i < n; ++i) {
+            h = (h << 1) + gear[p[i]];
+            if (!(h & mask_large_)) return i + 1;
+        }
+        return n;
+    }
+
+    /**
+     * @brief Split @p data into fingerprinted chunks
+     */
+    [[nodiscard]] std::vector<Chunk> chunk(std::span<const std::byte> data) const {
+        std::vector<Chunk> chunks;
+        chunks.reserve(data.size() / options_.avg_size + 1);
+        size_t offset = 0;
+        while (offset < data.size()) {
+            size_t length = next_boundary(data.subspan(offset));
+            auto bytes = data.subspan(offset, length);
+            chunks.push_back({offset, static_cast<uint32_t>(length), ChunkFingerprint::of(bytes)});
+            offset += length;
+        }
+        return chunks;
+    }
+};
+
+/**
+ * @brief Set of chunk fingerprints stored on a target node
+ *
+ * The target answers contains() for a batch of fingerprints during the
+ * exchange and add()s chunks as they arrive. Thread-safe.
+ */
+class ChunkIndex {
+private:
+    mutable std::mutex mutex_;
+    std::unordered_set<ChunkFingerprint, ChunkFingerprintHash> chunks_;
+    size_t stored_bytes_ = 0;
+
+public:
+    /**
+     * @brief Answer a fingerprint exchange: which of @p fingerprints are present
+     */
+    [[nodiscard]] std::vector<bool> contains(std::span<const ChunkFingerprint> fingerprints) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<bool> present(fingerprints.size());
+        for (size_t i = 0; i < fingerprints.size(); ++i) {
+            present[i] = chunks_.count(fingerprints[i]) > 0;
+        }
+        return present;
+    }
+
+    /**
+     * @brief Record a stored chunk
+     * @return false if it was already present
+     */
+    bool add(const ChunkFingerprint& fingerprint, size_t size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!chunks_.insert(fingerprint).second) return false;
+        stored_bytes_ += size;
+        return true;
+    }
+
+    [[nodiscard]] size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return chunks_.size();
+    }
+
+    [[nodiscard]] size_t stored_bytes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stored_bytes_;
+    }
+};
+
+/**
+ * @brief Chunks to ship after a fingerprint exchange
+ */
+struct DedupPlan {
+    std::vector<Chunk> recipe;              ///< All chunks in order (reassembly on target)
+    std::vector<size_t> to_send;            ///< Indices into recipe whose bytes must be sent
+    size_t total_bytes = 0;
+    size_t send_bytes = 0;
+
+    /**
+     * @brief Fraction of bytes kept off the wire
+     */
+    [[nodiscard]] double savings() const {
+        return total_bytes > 0
+            ? 1.0 - static_cast<double>(send_bytes) / static_cast<double>(total_bytes)
+            : 0.0;
+    }
+};
+
+/**
+ * @brief Chunk @p data and drop chunks the target (or this stream) already has
+ */
+[[nodiscard]] inline DedupPlan plan_dedup(const ContentChunker& chunker,
+                                          std::span<const std::byte> data,
+                                          const ChunkIndex& target) {
+    DedupPlan plan;
+    plan.recipe = chunker.chunk(data);
+    plan.total_bytes = data.size();
+
+    std::vector<ChunkFingerprint> fingerprints;
+    fingerprints.reserve(plan.recipe.size());
+    for (const auto& chunk : plan.recipe) {
+        fingerprints.push_back(chunk.fingerprint);
+    }
+    auto present = target.contains(fingerprints);
+
+    std::unordered_set<ChunkFingerprint, ChunkFingerprintHash> sending;
+    for (size_t i = 0; i < plan.recipe.size(); ++i) {
+        if (present[i] || !sending.insert(plan.recipe[i].fingerprint).second) continue;
+        plan.to_send.push_back(i);
+        plan.send_bytes += plan.recipe[i].size;
+    }
+    return plan;
+}
+
+} // namespace redcomponent::offloading
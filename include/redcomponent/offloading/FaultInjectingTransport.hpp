@@ -0,0 +1,158 @@
+/**
+ * @file FaultInjectingTransport.hpp
+ * @brief Transport Decorator Injecting Latency, Throttling and Failures
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "Transport.hpp"
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Faults applied by FaultInjectingTransport
+ *
+ * Probabilities are per send_segment() call and independent.
+ */
+struct FaultProfile {
+    std::chrono::microseconds latency{0};   ///< Added round-trip latency per segment
+    double bandwidth_bytes_per_second = 0;  ///< Throughput cap (0 = unlimited)
+    double stall_probability = 0.0;         ///< Chance of a stall before delivery
+    std::chrono::microseconds stall_duration{std::chrono::milliseconds{200}};
+    std::chrono::microseconds ack_timeout{0}; ///< Stalls at least this long time out (0 = never)
+    double reset_probability = 0.0;         ///< Chance the connection is reset mid-segment
+    double corruption_probability = 0.0;    ///< Chance one payload bit is flipped in flight
+
+    /**
+     * @brief Profile failing @p rate of segments, split evenly between resets and corruption
+     */
+    [[nodiscard]] static FaultProfile segment_failures(double rate) {
+        FaultProfile profile;
+        profile.reset_probability = rate / 2.0;
+        profile.corruption_probability = rate / 2.0;
+        return profile;
+    }
+};
+
+/**
+ * @brief Counters of what FaultInjectingTransport did
+ */
+struct FaultStats {
+    size_t segments = 0;                    ///< send_segment() calls
+    size_t delivered = 0;                   ///< Segments the inner transport acknowledged
+    size_t delivered_bytes = 0;
+    size_t stalls = 0;
+    size_t timeouts = 0;
+    size_t resets = 0;
+    size_t corruptions = 0;
+    std::chrono::microseconds injected_delay{0}; ///< Latency, throttling and stall time
+};
+
+/**
+ * @brief Decorator injecting network faults into any ITransport
+ *
+ * Per segment, in order: stall (may time out), latency plus serialization
+ * delay at the bandwidth cap, connection reset (the inner transport is
+ * disconnected before delivery), bit-flip corruption (delivered with the
+ * sender's checksum so the target rejects it). All randomness comes from
+ * a seeded generator; delays go through an injectable SleepFunction so
+ * benchmarks can run in virtual time.
+ */
+class FaultInjectingTransport : public ITransport {
+private:
+    ITransport& inner_;
+    FaultProfile profile_;
+    SleepFunction sleep_;
+    std::mt19937_64 rng_;
+    std::vector<std::byte> scratch_;
+    FaultStats stats_;
+
+    [[nodiscard]] bool chance(double probability) {
+        if (probability <= 0.0) return false;
+        return static_cast<double>(rng_() >> 11) * 0x1.0p-53 < probability;
+    }
+
+    void delay(std::chrono::microseconds duration) {
+        if (duration.count() <= 0) return;
+        stats_.injected_delay += duration;
+        sleep_(duration);
+    }
+
+public:
+    /**
+     * @brief Construct decorator
+     * @param inner Transport receiving the (possibly faulted) traffic
+     * @param profile Faults to inject
+     * @param seed RNG seed
+     * @param sleep Delay function (real_sleep or a virtual clock)
+     */
+    FaultInjectingTransport(ITransport& inner, const FaultProfile& profile,
+                            uint64_t seed = 1, SleepFunction sleep = real_sleep)
+        : inner_(inner), profile_(profile), sleep_(std::move(sleep)), rng_(seed) {}
+
+    bool connect(const TargetNode& node) override {
+        delay(profile_.latency);
+        return inner_.connect(node);
+    }
+
+    void disconnect() override { inner_.disconnect(); }
+
+    [[nodiscard]] bool is_connected() const override { return inner_.is_connected(); }
+
+    TransportStatus send_segment(uint64_t segment_id, std::span<const std::byte> payload,
+                                 uint32_t checksum) override {
+        if (!inner_.is_connected()) return TransportStatus::NotConnected;
+        stats_.segments++;
+
+        if (chance(profile_.stall_probability)) {
+            stats_.stalls++;
+            if (profile_.ack_timeout.count() > 0 &&
+                profile_.stall_duration >= profile_.ack_timeout) {
+                delay(profile_.ack_timeout);
+                stats_.timeouts++;
+                return TransportStatus::Timeout;
+            }
+            delay(profile_.stall_duration);
+        }
+
+        auto serialization = profile_.bandwidth_bytes_per_second > 0
+            ? std::chrono::microseconds{static_cast<int64_t>(
+                  static_cast<double>(payload.size()) * 1e6 / profile_.bandwidth_bytes_per_second)}
+            : std::chrono::microseconds{0};
+        delay(profile_.latency + serialization);
+
+        if (chance(profile_.reset_probability)) {
+            stats_.resets++;
+            inner_.disconnect();
+            return TransportStatus::ConnectionReset;
+        }
+
+        std::span<const std::byte> delivered = payload;
+        if (!payload.empty() && chance(profile_.corruption_probability)) {
+            stats_.corruptions++;
+            scratch_.assign(payload.begin(), payload.end());
+            size_t bit = static_cast<size_t>(rng_() % (payload.size() * 8));
+            scratch_[bit / 8] ^= static_cast<std::byte>(1u << (bit % 8));
+            delivered = scratch_;
+        }
+
+        TransportStatus status = inner_.send_segment(segment_id, delivered, checksum);
+        if (status == TransportStatus::Ok) {
+            stats_.delivered++;
+            stats_.delivered_bytes += payload.size();
+        }
+        return status;
+    }
+
+    void set_profile(const FaultProfile& profile) { profile_ = profile; }
+    [[nodiscard]] const FaultProfile& profile() const { return profile_; }
+    [[nodiscard]] const FaultStats& stats() const { return stats_; }
+};
+
+} // namespace redcomponent::offloading
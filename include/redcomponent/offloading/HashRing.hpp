@@ -0,0 +1,219 @@
+/**
+ * @file HashRing.hpp
+ * @brief Capacity-Weighted Consistent Hash Ring with Bounded Loads
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "IOffloadManager.hpp"
+#include "Checksum.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Hash ring tuning
+ */
+struct HashRingOptions {
+    size_t bytes_per_vnode = 8ULL * 1024 * 1024 * 1024;   ///< Storage per virtual node (capacity weight)
+    size_t max_vnodes_per_node = 4096;      ///< Cap for very large nodes
+    double load_factor = 1.25;              ///< Bounded-load c: no node exceeds c x its fair share
+};
+
+/**
+ * @brief Consistent hash ring over TargetNodes
+ *
+ * Each node owns total_storage_bytes / bytes_per_vnode virtual nodes, so
+ * keys spread in proportion to capacity, and adding or removing a node
+ * only moves the keys of its own arcs. Lookups binary-search the sorted
+ * vnode table (O(log vnodes)) and need no shared state, so any proxy
+ * holding the same membership resolves the same owner.
+ *
+ * place() adds bounded loads (consistent hashing with bounded loads):
+ * a node already holding more than load_factor times its capacity share
+ * of placed bytes is skipped for the next node clockwise. Routers
+ * resolve such keys by probing candidates() in ring order.
+ *
+ * Not thread-safe; owners serialize access (e.g. under the manager lock).
+ */
+class HashRing {
+private:
+    struct VirtualNode {
+        uint64_t hash;
+        uint32_t member;
+    };
+
+    struct Member {
+        std::string node_id;
+        size_t vnodes = 0;
+        size_t load_bytes = 0;
+        bool active = false;
+    };
+
+    HashRingOptions options_;
+    std::vector<VirtualNode> ring_;         // Sorted by hash
+    std::vector<Member> members_;
+    std::map<std::string, uint32_t> index_;
+    size_t total_vnodes_ = 0;
+    size_t total_load_ = 0;
+
+    [[nodiscard]] static uint64_t hash_key(std::string_view key) {
+        return content_hash64(std::as_bytes(std::span<const char>(key.data(), key.size())));
+    }
+
+    [[nodiscard]] size_t vnodes_for(const TargetNode& node) const {
+        size_t per = std::max<size_t>(options_.bytes_per_vnode, 1);
+        size_t count = (node.total_storage_bytes + per / 2) / per;
+        return std::clamp<size_t>(count, 1, options_.max_vnodes_per_node);
+    }
+
+    [[nodiscard]] size_t first_vnode(uint64_t hash) const {
+        auto it = std::lower_bound(ring_.begin(), ring_.end(), hash,
+            [](const VirtualNode& v, uint64_t h) { return v.hash < h; });
+        return it == ring_.end() ? 0 : static_cast<size_t>(it - ring_.begin());
+    }
+
+    [[nodiscard]] size_t capacity_bytes(const Member& member, size_t extra) const {
+        double share = static_cast<double>(member.vnodes) / static_cast<double>(total_vnodes_);
+        return static_cast<size_t>(std::ceil(
+            options_.load_factor * share * static_cast<double>(total_load_ + extra)));
+    }
+
+public:
+    explicit HashRing(const HashRingOptions& options = {}) : options_(options) {}
+
+    /**
+     * @brief Add a node (no-op if present)
+     */
+    void add_node(const TargetNode& node) {
+        auto [it, inserted] = index_.try_emplace(node.node_id,
+                                                 static_cast<uint32_t>(members_.size()));
+        if (inserted) {
+            members_.push_back(Member{node.node_id});
+        }
+        Member& member = members_[it->second];
+        if (member.active) return;
+
+        member.active = true;
+        member.vnodes = vnodes_for(node);
+        total_vnodes_ += member.vnodes;
+        for (size_t v = 0; v < member.vnodes; ++v) {
+            ring_.push_back({hash_key(node.node_id + "#" + std::to_string(v)), it->second});
+        }
+        std::sort(ring_.begin(), ring_.end(),
+            [](const VirtualNode& a, const VirtualNode& b) { return a.hash < b.hash; });
+    }
+
+    /**
+     * @brief Remove a node; its keys fall to the next nodes clockwise
+     */
+    void remove_node(const std::string& node_id) {
+        auto it = index_.find(node_id);
+        if (it == index_.end() || !members_[it->second].active) return;
+        uint32_t member = it->second;
+        std::erase_if(ring_, [member](const VirtualNode& v) { return v.member == member; });
+        total_vnodes_ -= members_[member].vnodes;
+        total_load_ -= members_[member].load_bytes;
+        members_[member] = Member{node_id};
+    }
+
+    /**
+     * @brief Sync membership with @p nodes, adding and removing only the difference
+     */
+    void rebuild(const std::vector<TargetNode>& nodes) {
+        std::map<std::string, const TargetNode*> wanted;
+        for (const auto& node : nodes) {
+            wanted[node.node_id] = &node;
+        }
+        std::vector<std::string> gone;
+        for (const auto& member : members_) {
+            if (member.active && !wanted.count(member.node_id)) gone.push_back(member.node_id);
+        }
+        for (const auto& id : gone) {
+            remove_node(id);
+        }
+        for (const auto& [id, node] : wanted) {
+            add_node(*node);
+        }
+    }
+
+    /**
+     * @brief Owner of @p key ignoring loads (stateless routing)
+     */
+    [[nodiscard]] std::optional<std::string> owner(std::string_view key) const {
+        if (ring_.empty()) return std::nullopt;
+        return members_[ring_[first_vnode(hash_key(key))].member].node_id;
+    }
+
+    /**
+     * @brief Up to @p count distinct nodes in ring order from @p key
+     */
+    [[nodiscard]] std::vector<std::string> candidates(std::string_view key, size_t count) const {
+        std::vector<std::string> out;
+        if (ring_.empty()) return out;
+        std::vector<bool> seen(members_.size(), false);
+        size_t start = first_vnode(hash_key(key));
+        for (size_t i = 0; i < ring_.size() && out.size() < count; ++i) {
+            uint32_t member = ring_[(start + i) % ring_.size()].member;
+            if (!seen[member]) {
+                seen[member] = true;
+                out.push_back(members_[member].node_id);
+            }
+        }
+        return out;
+    }
+
+    /**
+     * @brief Assign @p key of @p bytes to the first node clockwise with room
+     */
+    std::optional<std::string> place(std::string_view key, size_t bytes) {
+        if (ring_.empty()) return std::nullopt;
+        size_t start = first_vnode(hash_key(key));
+        for (size_t i = 0; i < ring_.size(); ++i) {
+            Member& member = members_[ring_[(start + i) % ring_.size()].member];
+            if (member.load_bytes + bytes <= capacity_bytes(member, bytes)) {
+                member.load_bytes += bytes;
+                total_load_ += bytes;
+                return member.node_id;
+            }
+        }
+        return std::nullopt;    // Unreachable for load_factor >= 1
+    }
+
+    /**
+     * @brief Return load of a key placed on @p node_id (deleted or moved)
+     */
+    void release(const std::string& node_id, size_t bytes) {
+        auto it = index_.find(node_id);
+        if (it == index_.end()) return;
+        Member& member = members_[it->second];
+        bytes = std::min(bytes, member.load_bytes);
+        member.load_bytes -= bytes;
+        total_load_ -= bytes;
+    }
+
+    [[nodiscard]] size_t load_bytes(const std::string& node_id) const {
+        auto it = index_.find(node_id);
+        return it == index_.end() ? 0 : members_[it->second].load_bytes;
+    }
+
+    [[nodiscard]] size_t vnode_count(const std::string& node_id) const {
+        auto it = index_.find(node_id);
+        return it == index_.end() ? 0 : members_[it->second].vnodes;
+    }
+
+    [[nodiscard]] size_t size() const { return ring_.size(); }
+    [[nodiscard]] bool empty() const { return ring_.empty(); }
+};
+
+} // namespace redcomponent::offloading
@@ -14,6 +14,7 @@
 #include <optional>
 #include <functional>
 #include <cstdint>
+#include <cmath>
 
 namespace redcomponent::offloading {
 
@@ -67,6 +68,7 @@ struct TargetNode {
     uint16_t port = 5432;                   ///< Node port
     std::string cluster_id;                 ///< Cluster identifier
     std::string region;                     ///< Geographic region
+    std::string zone;                       ///< Rack/zone label (optional)
 
     // Resource information
     size_t total_storage_bytes = 0;         ///< Total storage capacity
@@ -118,6 +120,7 @@ struct OffloadConfig {
     size_t segment_size = 1 * 1024 * 1024;      ///< Transfer segment size (1MB)
     size_t max_concurrent_transfers = 4;        ///< Maximum parallel transfers
     size_t transfer_buffer_size = 64 * 1024;    ///< Transfer buffer size (64KB)
+    size_t max_stripe_targets = 1;              ///< Nodes a single offload may stripe across (1 = no striping)
 
     // Timeouts
     std::chrono::seconds connect_timeout{30};   ///< Connection timeout
@@ -133,12 +136,13 @@ struct OffloadConfig {
     bool auto_offload = true;                   ///< Enable automatic offloading
     bool compress_transfers = true;             ///< Compress data during transfer
     bool verify_integrity = true;               ///< Verify data integrity after transfer
-    bool prefer_local_region = true;            ///< Prefer nodes in same region
+    bool prefer_local_region = true;            ///< Prefer nodes in same region (fallback to others)
 
     // Node selection
     size_t min_available_storage_bytes = 1024ULL * 1024 * 1024; ///< Minimum available storage on target
     double max_target_cpu_usage = 80.0;         ///< Maximum CPU usage on target node
     double max_target_memory_usage = 85.0;      ///< Maximum memory usage on target node
+    size_t selection_choices = 0;               ///< Random candidates compared per auto-selection (0 = all)
 };
 
 /**
@@ -162,8 +166,9 @@ struct OffloadProgress {
     std::chrono::microseconds elapsed{0};
 
     // Transfer rate
-    double bytes_per_second = 0.0;              ///< Current transfer rate
+    double bytes_per_second = 0.0;              ///< Current transfer rate (sliding window)
     double average_bytes_per_second = 0.0;      ///< Average transfer rate
+    double smoothed_bytes_per_second = 0.0;     ///< EWMA-smoothed transfer rate
 
     // Status
     std::optional<std::string> error_message;
@@ -179,13 +184,18 @@ struct OffloadProgress {
 
     /**
      * @brief Calculate estimated time remaining
+     *
+     * Uses the smoothed rate when available, otherwise the average rate.
+     * Rounds up so a transfer with pending bytes never reports zero.
      */
     [[nodiscard]] std::chrono::seconds estimated_time_remaining() const {
-        if (average_bytes_per_second <= 0 || pending_bytes == 0) {
+        double rate = smoothed_bytes_per_second > 0 ? smoothed_bytes_per_second
+                                                    : average_bytes_per_second;
+        if (rate <= 0 || pending_bytes == 0) {
             return std::chrono::seconds{0};
         }
         return std::chrono::seconds{
-            static_cast<int64_t>(pending_bytes / average_bytes_per_second)
+            static_cast<int64_t>(std::ceil(pending_bytes / rate))
         };
     }
 
@@ -0,0 +1,355 @@
+/**
+ * @file KeyFilter.hpp
+ * @brief Cuckoo Filter Summaries of Offloaded Data Ids per Target Node
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "Checksum.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Fixed-capacity cuckoo filter over string keys
+ *
+ * Buckets of four 16-bit fingerprints with partial-key cuckoo hashing:
+ * a key may sit in bucket i1 = hash or i2 = i1 ^ hash(fingerprint), so
+ * the alternate bucket of a stored fingerprint is computable without the
+ * key. Membership is answered with no false negatives and a false
+ * positive rate of about 8 / 2^16 (~0.012%) at full load; usable load is
+ * ~95%. Once insert() fails the filter is full and the caller starts a
+ * new one. Not thread-safe.
+ */
+class CuckooFilter {
+public:
+    static constexpr size_t kSlotsPerBucket = 4;
+    static constexpr size_t kMaxKicks = 500;
+    static constexpr uint32_t kImageMagic = 0x464B4352u;   // "RCKF"
+    static constexpr uint16_t kImageVersion = 1;
+
+private:
+    std::vector<uint16_t> slots_;       // bucket * kSlotsPerBucket + slot; 0 = empty
+    size_t bucket_mask_ = 0;
+    size_t count_ = 0;
+    uint64_t kick_state_ = 0x2545F4914F6CDD1Dull;
+
+    struct Victim {
+        size_t bucket;
+        uint16_t fingerprint;
+    };
+    std::optional<Victim> victim_;      // Evicted entry that found no slot; filter is full
+
+    struct Location {
+        size_t bucket;
+        uint16_t fingerprint;
+    };
+
+    [[nodiscard]] Location locate(std::string_view key) const {
+        uint64_t h = content_hash64(std::as_bytes(std::span<const char>(key.data(), key.size())));
+        auto fingerprint = static_cast<uint16_t>(h >> 48);
+        return {static_cast<size_t>(h) & bucket_mask_, fingerprint ? fingerprint : uint16_t{1}};
+    }
+
+    [[nodiscard]] size_t alt_bucket(size_t bucket, uint16_t fingerprint) const {
+        return (bucket ^ (static_cast<size_t>(fingerprint) * 0x5BD1E995u)) & bucket_mask_;
+    }
+
+    [[nodiscard]] bool bucket_has(size_t bucket, uint16_t fingerprint) const {
+        for (size_t s = 0; s < kSlotsPerBucket; ++s) {
+            if (slots_[bucket * kSlotsPerBucket + s] == fingerprint) return true;
+        }
+        return false;
+    }
+
+    bool bucket_put(size_t bucket, uint16_t fingerprint) {
+        for (size_t s = 0; s < kSlotsPerBucket; ++s) {
+            uint16_t& slot = slots_[bucket * kSlotsPerBucket + s];
+            if (slot == 0) {
+                slot = fingerprint;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    CuckooFilter() = default;
+
+public:
+    /**
+     * @brief Filter sized for about @p capacity keys
+     */
+    explicit CuckooFilter(size_t capacity) {
+        size_t buckets = std::bit_ceil(std::max<size_t>(
+            (capacity * 100 / 95 + kSlotsPerBucket - 1) / kSlotsPerBucket, 1));
+        slots_.assign(buckets * kSlotsPerBucket, 0);
+        bucket_mask_ = buckets - 1;
+    }
+
+    /**
+     * @brief Add @p key
+     * @return false if the filter is full (the key is not represented)
+     */
+    bool insert(std::string_view key) {
+        if (victim_) return false;
+        auto [bucket, fingerprint] = locate(key);
+        if (bucket_has(bucket, fingerprint) ||
+            bucket_has(alt_bucket(bucket, fingerprint), fingerprint)) {
+            return true;    // Already represented (or an indistinguishable collision)
+        }
+        count_++;
+        if (bucket_put(bucket, fingerprint)) return true;
+        bucket = alt_bucket(bucket, fingerprint);
+        if (bucket_put(bucket, fingerprint)) return true;
+
+        for (size_t kick = 0; kick < kMaxKicks; ++kick) {
+            kick_state_ ^= kick_state_ << 13;
+            kick_state_ ^= kick_state_ >> 7;
+            kick_state_ ^= kick_state_ << 17;
+            std::swap(fingerprint, slots_[bucket * kSlotsPerBucket + kick_state_ % kSlotsPerBucket]);
+            bucket = alt_bucket(bucket, fingerprint);
+            if (bucket_put(bucket, fingerprint)) return true;
+        }
+        victim_ = Victim{bucket, fingerprint};  // Still answered by contains()
+        return true;
+    }
+
+    /**
+     * @brief Whether @p key may have been inserted (never false for inserted keys)
+     */
+    [[nodiscard]] bool contains(std::string_view key) const {
+        auto [bucket, fingerprint] = locate(key);
+        size_t alt = alt_bucket(bucket, fingerprint);
+        if (victim_ && victim_->fingerprint == fingerprint &&
+            (victim_->bucket == bucket || victim_->bucket == alt)) {
+            return true;
+        }
+        return bucket_has(bucket, fingerprint) || bucket_has(alt, fingerprint);
+    }
+
+    [[nodiscard]] size_t size() const { return count_; }
+    [[nodiscard]] bool full() const { return victim_.has_value(); }
+    [[nodiscard]] size_t slot_count() const { return slots_.size(); }
+
+    [[nodiscard]] double load_factor() const {
+        return static_cast<double>(count_) / static_cast<double>(slots_.size());
+    }
+
+    /**
+     * @brief Exchange image
+     *
+     * Layout (little-endian): magic u32, version u16, has-victim u16,
+     * bucket count u32, key count u64, victim bucket u32 + fingerprint
+     * u16, slots (u16 each), CRC32C u32 of everything before it. About
+     * 2.1 bytes per key at 95% load.
+     */
+    [[nodiscard]] std::vector<std::byte> serialize() const {
+        std::vector<std::byte> out;
+        auto put = [&out](uint64_t value, size_t bytes) {
+            for (size_t i = 0; i < bytes; ++i) {
+                out.push_back(static_cast<std::byte>(value >> (8 * i)));
+            }
+        };
+        out.reserve(26 + slots_.size() * 2);
+        put(kImageMagic, 4);
+        put(kImageVersion, 2);
+        put(victim_ ? 1 : 0, 2);
+        put(bucket_mask_ + 1, 4);
+        put(count_, 8);
+        put(victim_ ? victim_->bucket : 0, 4);
+        put(victim_ ? victim_->fingerprint : 0, 2);
+        for (uint16_t slot : slots_) {
+            put(slot, 2);
+        }
+        put(crc32c(out), 4);
+        return out;
+    }
+
+    /**
+     * @brief Rebuild a filter from serialize() output
+     * @return nullopt if the image is truncated, corrupt or of another version
+     */
+    [[nodiscard]] static std::optional<CuckooFilter> deserialize(std::span<const std::byte> image) {
+        constexpr size_t kHeader = 26;
+        if (image.size() < kHeader + 4) return std::nullopt;
+        size_t pos = 0;
+        auto get = [&](size_t bytes) {
+            uint64_t value = 0;
+            for (size_t i = 0; i < bytes; ++i) {
+                value |= static_cast<uint64_t>(image[pos + i]) << (8 * i);
+            }
+            pos += bytes;
+            return value;
+        };
+
+        auto body = image.first(image.size() - 4);
+        if (get(4) != kImageMagic || get(2) != kImageVersion) return std::nullopt;
+        bool has_victim = get(2) != 0;
+        size_t buckets = get(4);
+        if (!std::has_single_bit(buckets) ||
+            body.size() != kHeader + buckets * kSlotsPerBucket * 2) {
+            return std::nullopt;
+        }
+        pos = body.size();
+        if (get(4) != crc32c(body)) return std::nullopt;
+
+        CuckooFilter filter;
+        pos = 12;
+        filter.bucket_mask_ = buckets - 1;
+        filter.count_ = get(8);
+        size_t victim_bucket = get(4);
+        auto victim_fingerprint = static_cast<uint16_t>(get(2));
+        if (has_victim) {
+            filter.victim_ = Victim{victim_bucket & filter.bucket_mask_, victim_fingerprint};
+        }
+        filter.slots_.resize(buckets * kSlotsPerBucket);
+        for (auto& slot : filter.slots_) {
+            slot = static_cast<uint16_t>(get(2));
+        }
+        return filter;
+    }
+};
+
+/**
+ * @brief Offloaded-key summaries of every target node
+ *
+ * Each node's summary is a chain of cuckoo filters; when the newest is
+ * full a new one of twice the capacity is started, so the summary grows
+ * with the node without rehashing keys. The source adds data ids as
+ * their segments complete; during health checks targets send their own
+ * summary, which replaces the local one (the target's view is
+ * authoritative and also drops recalled keys). A negative answer skips
+ * the node; a positive one is confirmed against the directory.
+ * Thread-safe.
+ */
+class NodeKeyFilters {
+private:
+    mutable std::mutex mutex_;
+    size_t initial_capacity_;
+    std::map<std::string, std::vector<CuckooFilter>, std::less<>> filters_;
+
+public:
+    explicit NodeKeyFilters(size_t initial_capacity = 4096)
+        : initial_capacity_(std::max<size_t>(initial_capacity, 1)) {}
+
+    /**
+     * @brief Record that @p data_id is on @p node_id
+     */
+    void add(const std::string& node_id, std::string_view data_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& chain = filters_[node_id];
+        if (chain.empty()) {
+            chain.emplace_back(initial_capacity_);
+        }
+        if (!chain.back().insert(data_id)) {
+            chain.emplace_back(chain.back().slot_count() * 2);
+            chain.back().insert(data_id);
+        }
+    }
+
+    /**
+     * @brief Whether @p node_id may hold @p data_id
+     */
+    [[nodiscard]] bool might_contain(std::string_view node_id, std::string_view data_id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = filters_.find(node_id);
+        if (it == filters_.end()) return false;
+        for (const auto& filter : it->second) {
+            if (filter.contains(data_id)) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Nodes that may hold @p data_id (usually zero or one)
+     */
+    [[nodiscard]] std::vector<std::string> candidates(std::string_view data_id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<std::string> nodes;
+        for (const auto& [node_id, chain] : filters_) {
+            for (const auto& filter : chain) {
+                if (filter.contains(data_id)) {
+                    nodes.push_back(node_id);
+                    break;
+                }
+            }
+        }
+        return nodes;
+    }
+
+    /**
+     * @brief Summary of @p node_id to send to peers (filter images, each length-prefixed)
+     */
+    [[nodiscard]] std::vector<std::byte> serialize(std::string_view node_id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<std::byte> out;
+        auto it = filters_.find(node_id);
+        if (it == filters_.end()) return out;
+        for (const auto& filter : it->second) {
+            auto image = filter.serialize();
+            for (size_t i = 0; i < 4; ++i) {
+                out.push_back(static_cast<std::byte>(image.size() >> (8 * i)));
+            }
+            out.insert(out.end(), image.begin(), image.end());
+        }
+        return out;
+    }
+
+    /**
+     * @brief Replace @p node_id's summary with one received from the node
+     * @return false (summary unchanged) if any filter image is invalid
+     */
+    bool merge_remote(const std::string& node_id, std::span<const std::byte> summary) {
+        std::vector<CuckooFilter> chain;
+        size_t pos = 0;
+        while (pos < summary.size()) {
+            if (summary.size() - pos < 4) return false;
+            size_t len = 0;
+            for (size_t i = 0; i < 4; ++i) {
+                len |= static_cast<size_t>(summary[pos + i]) << (8 * i);
+            }
+            pos += 4;
+            if (summary.size() - pos < len) return false;
+            auto filter = CuckooFilter::deserialize(summary.subspan(pos, len));
+            if (!filter) return false;
+            chain.push_back(std::move(*filter));
+            pos += len;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        filters_[node_id] = std::move(chain);
+        return true;
+    }
+
+    void forget(std::string_view node_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = filters_.find(node_id);
+        if (it != filters_.end()) filters_.erase(it);
+    }
+
+    [[nodiscard]] size_t key_count(std::string_view node_id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = filters_.find(node_id);
+        if (it == filters_.end()) return 0;
+        size_t total = 0;
+        for (const auto& filter : it->second) {
+            total += filter.size();
+        }
+        return total;
+    }
+};
+
+} // namespace redcomponent::offloading
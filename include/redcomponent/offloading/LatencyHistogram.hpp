@@ -0,0 +1,207 @@
+/**
+ * @file LatencyHistogram.hpp
+ * @brief Lock-Free HDR-Style Latency Histograms for Segment Transfers
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Point-in-time copy of a LatencyHistogram
+ */
+struct HistogramSnapshot {
+    std::vector<uint64_t> counts;           ///< Per-bucket counts
+    uint64_t count = 0;                     ///< Number of recorded values
+    uint64_t sum_us = 0;                    ///< Sum of recorded values (us)
+    uint64_t min_us = 0;                    ///< Smallest recorded value (us)
+    uint64_t max_us = 0;                    ///< Largest recorded value (us)
+
+    /**
+     * @brief Mean latency
+     */
+    [[nodiscard]] std::chrono::microseconds mean() const {
+        if (count == 0) return std::chrono::microseconds{0};
+        return std::chrono::microseconds{static_cast<int64_t>(sum_us / count)};
+    }
+
+    /**
+     * @brief Latency at percentile @p p (0-100)
+     *
+     * Returns the upper bound of the bucket holding the requested rank,
+     * clamped to the observed maximum (relative error ~3%).
+     */
+    [[nodiscard]] std::chrono::microseconds percentile(double p) const;
+};
+
+/**
+ * @brief Fixed-memory log-linear latency histogram
+ *
+ * Values (microseconds) below 64 are recorded exactly; larger values are
+ * grouped into 32 linear sub-buckets per power of two, giving about 3%
+ * relative precision up to ~2^40 us. record() is wait-free apart from the
+ * min/max CAS loops and safe to call from any number of threads.
+ */
+class LatencyHistogram {
+public:
+    static constexpr unsigned kSubBucketBits = 5;
+    static constexpr uint64_t kSubBucketCount = 1ULL << kSubBucketBits;
+    static constexpr unsigned kMaxMagnitude = 40;
+    static constexpr size_t kBucketCount =
+        2 * kSubBucketCount + (kMaxMagnitude - kSubBucketBits - 1) * kSubBucketCount;
+    static constexpr uint64_t kMaxTrackableUs = (1ULL << kMaxMagnitude) - 1;
+
+private:
+    std::array<std::atomic<uint64_t>, kBucketCount> counts_{};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> min_{std::numeric_limits<uint64_t>::max()};
+    std::atomic<uint64_t> max_{0};
+
+public:
+    /**
+     * @brief Map a value to its bucket index
+     */
+    [[nodiscard]] static constexpr size_t bucket_index(uint64_t value_us) {
+        if (value_us > kMaxTrackableUs) value_us = kMaxTrackableUs;
+        if (value_us < 2 * kSubBucketCount) return static_cast<size_t>(value_us);
+        unsigned msb = static_cast<unsigned>(std::bit_width(value_us)) - 1;
+        unsigned shift = msb - kSubBucketBits;
+        uint64_t top = value_us >> shift;   // In [kSubBucketCount, 2*kSubBucketCount)
+        return static_cast<size_t>(
+            2 * kSubBucketCount + (shift - 1) * kSubBucketCount + (top - kSubBucketCount));
+    }
+
+    /**
+     * @brief Largest value that maps to bucket @p index
+     */
+    [[nodiscard]] static constexpr uint64_t bucket_upper_bound(size_t index) {
+        if (index < 2 * kSubBucketCount) return index;
+        size_t rel = index - 2 * kSubBucketCount;
+        unsigned shift = static_cast<unsigned>(rel / kSubBucketCount) + 1;
+        uint64_t top = kSubBucketCount + rel % kSubBucketCount;
+        return ((top + 1) << shift) - 1;
+    }
+
+    /**
+     * @brief Record a latency value
+     */
+    void record(std::chrono::microseconds latency) {
+        uint64_t v = latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+        counts_[bucket_index(v)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(v, std::memory_order_relaxed);
+
+        uint64_t cur = min_.load(std::memory_order_relaxed);
+        while (v < cur && !min_.compare_exchange_weak(cur, v, std::memory_order_relaxed)) {}
+        cur = max_.load(std::memory_order_relaxed);
+        while (v > cur && !max_.compare_exchange_weak(cur, v, std::memory_order_relaxed)) {}
+    }
+
+    /**
+     * @brief Copy the current state (concurrent records may be partially visible)
+     */
+    [[nodiscard]] HistogramSnapshot snapshot() const {
+        HistogramSnapshot snap;
+        snap.counts.resize(kBucketCount);
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            snap.counts[i] = counts_[i].load(std::memory_order_relaxed);
+            snap.count += snap.counts[i];
+        }
+        snap.sum_us = sum_.load(std::memory_order_relaxed);
+        snap.max_us = max_.load(std::memory_order_relaxed);
+        uint64_t min = min_.load(std::memory_order_relaxed);
+        snap.min_us = snap.count == 0 ? 0 : min;
+        return snap;
+    }
+
+    /**
+     * @brief Clear all recorded values (not atomic with concurrent records)
+     */
+    void reset() {
+        for (auto& c : counts_) c.store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+        min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+};
+
+inline std::chrono::microseconds HistogramSnapshot::percentile(double p) const {
+    if (count == 0) return std::chrono::microseconds{0};
+    p = std::clamp(p, 0.0, 100.0);
+    auto rank = static_cast<uint64_t>(p / 100.0 * static_cast<double>(count) + 0.5);
+    rank = std::clamp<uint64_t>(rank, 1, count);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            uint64_t value = std::min(LatencyHistogram::bucket_upper_bound(i), max_us);
+            return std::chrono::microseconds{static_cast<int64_t>(std::max(value, min_us))};
+        }
+    }
+    return std::chrono::microseconds{static_cast<int64_t>(max_us)};
+}
+
+/**
+ * @brief Snapshot of the segment latency histograms
+ */
+struct SegmentLatencySnapshot {
+    HistogramSnapshot transfer;             ///< Segment send-to-ack latency
+    HistogramSnapshot queue_wait;           ///< Time queued before transfer started
+    HistogramSnapshot verification;         ///< Integrity verification time
+};
+
+/**
+ * @brief Histograms recorded for each completed segment
+ */
+class SegmentLatencyMetrics {
+private:
+    LatencyHistogram transfer_;
+    LatencyHistogram queue_wait_;
+    LatencyHistogram verification_;
+
+public:
+    /**
+     * @brief Record the timings of one segment
+     */
+    void record(std::chrono::microseconds transfer,
+                std::chrono::microseconds queue_wait,
+                std::chrono::microseconds verification) {
+        transfer_.record(transfer);
+        queue_wait_.record(queue_wait);
+        verification_.record(verification);
+    }
+
+    [[nodiscard]] SegmentLatencySnapshot snapshot() const {
+        return {transfer_.snapshot(), queue_wait_.snapshot(), verification_.snapshot()};
+    }
+
+    void reset() {
+        transfer_.reset();
+        queue_wait_.reset();
+        verification_.reset();
+    }
+};
+
+/**
+ * @brief Metrics snapshot of an offload manager
+ */
+struct OffloadMetricsSnapshot {
+    SegmentLatencySnapshot segments;        ///< All segments
+    std::map<std::string, SegmentLatencySnapshot> per_node; ///< Segments by target node
+    std::chrono::steady_clock::time_point taken_at;
+};
+
+} // namespace redcomponent::offloading
@@ -0,0 +1,179 @@
+/**
+ * @file LiveMigration.hpp
+ * @brief Iterative Pre-Copy Live Migration with Final Cutover
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "ChangeTracker.hpp"
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Live migration tuning
+ */
+struct LiveMigrationOptions {
+    std::chrono::milliseconds max_write_pause{500}; ///< Cutover budget for the final copy
+    size_t max_rounds = 10;                 ///< Pre-copy rounds before giving up on convergence
+    double min_shrink = 0.9;                ///< A round must leave < min_shrink x the previous dirty bytes
+    bool force_cutover = false;             ///< Cut over even if the final copy exceeds the budget
+};
+
+/**
+ * @brief Callbacks connecting the migration to the shard and the transport
+ */
+struct LiveMigrationHandlers {
+    std::function<bool(size_t page, uint64_t offset, size_t bytes)> send_page;
+    std::function<void()> pause_writes;     ///< Block new writes (reads may continue)
+    std::function<void()> resume_writes;    ///< Unblock writes (on the target after cutover)
+    std::function<bool()> cutover;          ///< Switch ownership/routing to the target
+};
+
+/**
+ * @brief Statistics of one copy round
+ */
+struct MigrationRound {
+    size_t pages = 0;
+    size_t bytes = 0;
+    std::chrono::microseconds duration{0};
+};
+
+/**
+ * @brief Outcome of a live migration
+ */
+struct LiveMigrationResult {
+    bool success = false;
+    std::optional<std::string> error_message;
+    std::vector<MigrationRound> rounds;     ///< Pre-copy rounds (first one is the bulk copy)
+    MigrationRound final_round;             ///< Copy done while writes were paused
+    std::chrono::microseconds write_pause{0}; ///< Pause to resume, including cutover
+    size_t total_bytes_sent = 0;
+};
+
+/**
+ * @brief Migrates a shard to a target while it keeps serving writes
+ *
+ * Pre-copy rounds ship every page dirty for the target (the first round
+ * ships everything) while writes continue and are recorded in the
+ * ChangeTracker. After each round the remaining dirty set is checked:
+ * once it can be copied within max_write_pause at the rate measured in
+ * the last round, writes are paused, the last dirty pages are sent and
+ * cutover() switches the shard over. If the dirty set stops shrinking or
+ * max_rounds is reached the migration aborts (or cuts over anyway with
+ * force_cutover) so a write-hot shard does not copy forever.
+ */
+class LiveMigration {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    ChangeTracker& tracker_;
+    std::string node_id_;
+    LiveMigrationOptions options_;
+    LiveMigrationHandlers handlers_;
+    std::function<Clock::time_point()> clock_;
+
+    bool copy(const DeltaPlan& plan, MigrationRound& round, LiveMigrationResult& result) {
+        auto start = clock_();
+        for (size_t page : plan.pages) {
+            uint64_t offset = tracker_.page_offset(page);
+            size_t bytes = std::min<uint64_t>(tracker_.page_size(), plan.total_bytes - offset);
+            if (!handlers_.send_page(page, offset, bytes)) {
+                result.error_message = "Failed to send page " + std::to_string(page);
+                return false;
+            }
+            round.bytes += bytes;
+            result.total_bytes_sent += bytes;
+        }
+        round.pages = plan.pages.size();
+        round.duration = std::chrono::duration_cast<std::chrono::microseconds>(clock_() - start);
+        tracker_.commit(plan);
+        return true;
+    }
+
+    [[nodiscard]] std::chrono::microseconds predicted_copy_time(
+        size_t bytes, const MigrationRound& last) const {
+        if (last.bytes == 0 || last.duration.count() <= 0) {
+            return std::chrono::microseconds{0};
+        }
+        double rate = static_cast<double>(last.bytes) / static_cast<double>(last.duration.count());
+        return std::chrono::microseconds{static_cast<int64_t>(static_cast<double>(bytes) / rate)};
+    }
+
+    LiveMigrationResult final_copy(LiveMigrationResult result) {
+        auto pause_start = clock_();
+        if (handlers_.pause_writes) handlers_.pause_writes();
+
+        bool ok = copy(tracker_.plan(node_id_), result.final_round, result);
+        if (ok && handlers_.cutover && !handlers_.cutover()) {
+            result.error_message = "Cutover rejected by target";
+            ok = false;
+        }
+
+        if (handlers_.resume_writes) handlers_.resume_writes();
+        result.write_pause = std::chrono::duration_cast<std::chrono::microseconds>(
+            clock_() - pause_start);
+        result.success = ok;
+        return result;
+    }
+
+public:
+    /**
+     * @brief Construct migration
+     * @param tracker Change tracker receiving the shard's writes
+     * @param node_id Target node
+     * @param options Tuning
+     * @param handlers Shard and transport callbacks
+     * @param clock Time source (injectable for tests)
+     */
+    LiveMigration(ChangeTracker& tracker, std::string node_id, LiveMigrationOptions options,
+                  LiveMigrationHandlers handlers,
+                  std::function<Clock::time_point()> clock = Clock::now)
+        : tracker_(tracker), node_id_(std::move(node_id)), options_(options),
+          handlers_(std::move(handlers)), clock_(std::move(clock)) {}
+
+    /**
+     * @brief Run pre-copy rounds and the cutover (blocking)
+     */
+    LiveMigrationResult run() {
+        LiveMigrationResult result;
+        size_t previous_dirty = 0;
+
+        for (size_t round = 0; round < options_.max_rounds; ++round) {
+            DeltaPlan plan = tracker_.plan(node_id_);
+            if (round > 0) {
+                auto predicted = predicted_copy_time(plan.bytes, result.rounds.back());
+                if (predicted <= options_.max_write_pause) {
+                    return final_copy(std::move(result));
+                }
+                if (static_cast<double>(plan.bytes) >=
+                    options_.min_shrink * static_cast<double>(previous_dirty)) {
+                    break;      // Writes outpace the copy
+                }
+            }
+            previous_dirty = plan.bytes;
+
+            MigrationRound stats;
+            if (!copy(plan, stats, result)) {
+                return result;
+            }
+            result.rounds.push_back(stats);
+        }
+
+        if (options_.force_cutover) {
+            return final_copy(std::move(result));
+        }
+        result.error_message = "Dirty pages did not converge after " +
+                               std::to_string(result.rounds.size()) + " rounds";
+        return result;
+    }
+};
+
+} // namespace redcomponent::offloading
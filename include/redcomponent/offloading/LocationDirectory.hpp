@@ -0,0 +1,316 @@
+/**
+ * @file LocationDirectory.hpp
+ * @brief Sharded Data-Id to Target-Node Directory with Binary Snapshots
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "Checksum.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Where offloaded data lives: data id -> target node id
+ *
+ * Entries are spread over kShardCount independently locked hash maps,
+ * so concurrent completions and proxy lookups rarely contend. Node ids
+ * are interned; an entry stores a 32-bit node index. Lookups take
+ * string_views without allocating a key and cost two uncontended locks
+ * and one hash probe (~100ns).
+ *
+ * Snapshots are a compact little-endian binary image with a CRC32C
+ * trailer (see serialize()), written atomically via a temporary file.
+ * Thread-safe.
+ */
+class LocationDirectory {
+public:
+    static constexpr size_t kShardCount = 64;
+    static constexpr uint32_t kSnapshotMagic = 0x444C4352u;    // "RCLD"
+    static constexpr uint16_t kSnapshotVersion = 1;
+
+private:
+    struct KeyHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view key) const { return std::hash<std::string_view>{}(key); }
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, uint32_t, KeyHash, std::equal_to<>> entries;
+    };
+
+    std::array<Shard, kShardCount> shards_;
+    mutable std::mutex nodes_mutex_;
+    std::vector<std::string> nodes_;
+    std::map<std::string, uint32_t, std::less<>> node_index_;
+
+    [[nodiscard]] Shard& shard_for(std::string_view data_id) {
+        return shards_[(KeyHash{}(data_id) >> 7) % kShardCount];
+    }
+
+    [[nodiscard]] const Shard& shard_for(std::string_view data_id) const {
+        return shards_[(KeyHash{}(data_id) >> 7) % kShardCount];
+    }
+
+    uint32_t intern(std::string_view node_id) {
+        std::lock_guard<std::mutex> lock(nodes_mutex_);
+        auto it = node_index_.find(node_id);
+        if (it != node_index_.end()) return it->second;
+        auto index = static_cast<uint32_t>(nodes_.size());
+        nodes_.emplace_back(node_id);
+        node_index_.emplace(std::string(node_id), index);
+        return index;
+    }
+
+    [[nodiscard]] std::optional<uint32_t> index_of(std::string_view node_id) const {
+        std::lock_guard<std::mutex> lock(nodes_mutex_);
+        auto it = node_index_.find(node_id);
+        if (it == node_index_.end()) return std::nullopt;
+        return it->second;
+    }
+
+    static void put(std::vector<std::byte>& out, uint64_t value, size_t bytes) {
+        for (size_t i = 0; i < bytes; ++i) {
+            out.push_back(static_cast<std::byte>(value >> (8 * i)));
+        }
+    }
+
+    static void put_string(std::vector<std::byte>& out, std::string_view s) {
+        put(out, s.size(), 2);
+        auto* p = reinterpret_cast<const std::byte*>(s.data());
+        out.insert(out.end(), p, p + s.size());
+    }
+
+    // Bounds-checked little-endian reader over a snapshot image
+    struct Reader {
+        std::span<const std::byte> data;
+        size_t pos = 0;
+        bool ok = true;
+
+        uint64_t get(size_t bytes) {
+            if (data.size() - pos < bytes) {
+                ok = false;
+                return 0;
+            }
+            uint64_t value = 0;
+            for (size_t i = 0; i < bytes; ++i) {
+                value |= static_cast<uint64_t>(data[pos + i]) << (8 * i);
+            }
+            pos += bytes;
+            return value;
+        }
+
+        std::string_view get_string() {
+            size_t len = get(2);
+            if (!ok || data.size() - pos < len) {
+                ok = false;
+                return {};
+            }
+            std::string_view s(reinterpret_cast<const char*>(data.data() + pos), len);
+            pos += len;
+            return s;
+        }
+    };
+
+public:
+    LocationDirectory() = default;
+    LocationDirectory(const LocationDirectory&) = delete;
+    LocationDirectory& operator=(const LocationDirectory&) = delete;
+
+    /**
+     * @brief Record that @p data_id now lives on @p node_id (replaces any previous owner)
+     */
+    void record(std::string_view data_id, std::string_view node_id) {
+        uint32_t node = intern(node_id);
+        Shard& shard = shard_for(data_id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.entries.find(data_id);
+        if (it != shard.entries.end()) {
+            it->second = node;
+        } else {
+            shard.entries.emplace(std::string(data_id), node);
+        }
+    }
+
+    /**
+     * @brief Node holding @p data_id, or nullopt if it was never offloaded
+     */
+    [[nodiscard]] std::optional<std::string> lookup(std::string_view data_id) const {
+        uint32_t node;
+        {
+            const Shard& shard = shard_for(data_id);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.entries.find(data_id);
+            if (it == shard.entries.end()) return std::nullopt;
+            node = it->second;
+        }
+        std::lock_guard<std::mutex> lock(nodes_mutex_);
+        return nodes_[node];
+    }
+
+    /**
+     * @brief Forget @p data_id (recalled or deleted)
+     */
+    bool erase(std::string_view data_id) {
+        Shard& shard = shard_for(data_id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.entries.find(data_id);
+        if (it == shard.entries.end()) return false;
+        shard.entries.erase(it);
+        return true;
+    }
+
+    /**
+     * @brief Forget every entry on @p node_id (node decommissioned)
+     * @return Number of entries removed
+     */
+    size_t erase_node(std::string_view node_id) {
+        auto node = index_of(node_id);
+        if (!node) return 0;
+        size_t removed = 0;
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            removed += std::erase_if(shard.entries,
+                [&](const auto& entry) { return entry.second == *node; });
+        }
+        return removed;
+    }
+
+    [[nodiscard]] size_t size() const {
+        size_t total = 0;
+        for (const auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            total += shard.entries.size();
+        }
+        return total;
+    }
+
+    void clear() {
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.entries.clear();
+        }
+    }
+
+    /**
+     * @brief Binary snapshot image
+     *
+     * Layout (little-endian): magic u32, version u16, reserved u16,
+     * node count u32, nodes (u16 length + bytes), entry count u64,
+     * entries (u16 length + id bytes + u32 node index), CRC32C u32 of
+     * everything before it. Each entry costs its id plus 6 bytes.
+     */
+    [[nodiscard]] std::vector<std::byte> serialize() const {
+        // Entries first: the node table only grows, so it covers every index they use
+        std::vector<std::byte> entries;
+        uint64_t count = 0;
+        for (const auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (const auto& [id, node] : shard.entries) {
+                put_string(entries, id);
+                put(entries, node, 4);
+                count++;
+            }
+        }
+
+        std::vector<std::byte> out;
+        put(out, kSnapshotMagic, 4);
+        put(out, kSnapshotVersion, 2);
+        put(out, 0, 2);
+        {
+            std::lock_guard<std::mutex> lock(nodes_mutex_);
+            put(out, nodes_.size(), 4);
+            for (const auto& node : nodes_) {
+                put_string(out, node);
+            }
+        }
+        put(out, count, 8);
+        out.insert(out.end(), entries.begin(), entries.end());
+        put(out, crc32c(out), 4);
+        return out;
+    }
+
+    /**
+     * @brief Replace the contents with a snapshot image
+     * @return false (contents unchanged) if the image is truncated, corrupt or of another version
+     */
+    bool deserialize(std::span<const std::byte> image) {
+        if (image.size() < 4) return false;
+        auto body = image.first(image.size() - 4);
+        Reader trailer{image.subspan(body.size())};
+        if (crc32c(body) != trailer.get(4)) return false;
+
+        Reader in{body};
+        if (in.get(4) != kSnapshotMagic || in.get(2) != kSnapshotVersion) return false;
+        in.get(2);
+
+        size_t node_count = in.get(4);
+        if (node_count > body.size()) return false;
+        std::vector<std::string_view> nodes(node_count);
+        for (auto& node : nodes) {
+            node = in.get_string();
+        }
+        std::vector<std::pair<std::string_view, uint32_t>> entries;
+        uint64_t count = in.get(8);
+        for (uint64_t i = 0; in.ok && i < count; ++i) {
+            std::string_view id = in.get_string();
+            auto node = static_cast<uint32_t>(in.get(4));
+            if (node >= nodes.size()) return false;
+            entries.emplace_back(id, node);
+        }
+        if (!in.ok || in.pos != body.size()) return false;
+
+        clear();
+        for (const auto& [id, node] : entries) {
+            record(id, nodes[node]);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Write a snapshot to @p path (via path.tmp and rename)
+     */
+    bool save(const std::filesystem::path& path) const {
+        auto image = serialize();
+        auto tmp = path;
+        tmp += ".tmp";
+        {
+            std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(image.data()),
+                       static_cast<std::streamsize>(image.size()));
+            if (!file) return false;
+        }
+        std::error_code ec;
+        std::filesystem::rename(tmp, path, ec);
+        return !ec;
+    }
+
+    /**
+     * @brief Load a snapshot written by save()
+     */
+    bool load(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return false;
+        std::vector<char> raw((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+        return deserialize(std::as_bytes(std::span<const char>(raw)));
+    }
+};
+
+} // namespace redcomponent::offloading
@@ -0,0 +1,274 @@
+/**
+ * @file MetricsRegistry.hpp
+ * @brief Allocation-Free Counters/Gauges with OpenMetrics Text Rendering
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <charconv>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Monotonic counter, safe to increment from any thread
+ */
+class Counter {
+private:
+    std::atomic<uint64_t> value_{0};
+
+public:
+    void inc(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+};
+
+/**
+ * @brief Gauge holding an arbitrary value, safe to update from any thread
+ */
+class Gauge {
+private:
+    std::atomic<double> value_{0.0};
+
+public:
+    void set(double v) { value_.store(v, std::memory_order_relaxed); }
+    void add(double v) {
+        double cur = value_.load(std::memory_order_relaxed);
+        while (!value_.compare_exchange_weak(cur, cur + v, std::memory_order_relaxed)) {}
+    }
+    [[nodiscard]] double value() const { return value_.load(std::memory_order_relaxed); }
+};
+
+/**
+ * @brief Label set of a metric series, in render order
+ */
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Registry of metric families rendered as OpenMetrics text
+ *
+ * counter()/gauge() find or create a series and return a reference that
+ * stays valid for the registry's lifetime. Hot paths hold on to those
+ * references, so updates are a single atomic operation with no lookup
+ * and no allocation. Registration and rendering share an internal
+ * mutex that is independent of any manager lock.
+ */
+class MetricsRegistry {
+public:
+    enum class Type { Counter, Gauge };
+
+private:
+    struct Series {
+        std::string labels;                 // Pre-rendered {k="v",...}
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+    };
+
+    struct Family {
+        std::string name;
+        std::string help;
+        Type type;
+        std::vector<Series> series;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Family>> families_;
+
+    static void append_escaped(std::string& out, const std::string& value) {
+        for (char c : value) {
+            switch (c) {
+                case '\\': out += "\\\\"; break;
+                case '"':  out += "\\\""; break;
+                case '\n': out += "\\n"; break;
+                default:   out += c; break;
+            }
+        }
+    }
+
+    static std::string render_labels(const MetricLabels& labels) {
+        if (labels.empty()) return {};
+        std::string out = "{";
+        for (size_t i = 0; i < labels.size(); ++i) {
+            if (i > 0) out += ',';
+            out += labels[i].first;
+            out += "=\"";
+            append_escaped(out, labels[i].second);
+            out += '"';
+        }
+        out += '}';
+        return out;
+    }
+
+    static void append_number(std::string& out, double value) {
+        char buf[32];
+        auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+        out.append(buf, ec == std::errc{} ? end : buf);
+    }
+
+    Series& find_or_create(const std::string& name, const std::string& help,
+                           Type type, const MetricLabels& labels) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        Family* family = nullptr;
+        for (auto& f : families_) {
+            if (f->name == name) {
+                family = f.get();
+                break;
+            }
+        }
+        if (!family) {
+            families_.push_back(std::make_unique<Family>(Family{name, help, type, {}}));
+            family = families_.back().get();
+        }
+
+        std::string rendered = render_labels(labels);
+        for (auto& s : family->series) {
+            if (s.labels == rendered) return s;
+        }
+        Series series;
+        series.labels = std::move(rendered);
+        if (family->type == Type::Counter) {
+            series.counter = std::make_unique<Counter>();
+        } else {
+            series.gauge = std::make_unique<Gauge>();
+        }
+        family->series.push_back(std::move(series));
+        return family->series.back();
+    }
+
+public:
+    /**
+     * @brief Get or register a counter series
+     * @param name Family name without the _total suffix
+     */
+    Counter& counter(const std::string& name, const std::string& help,
+                     const MetricLabels& labels = {}) {
+        return *find_or_create(name, help, Type::Counter, labels).counter;
+    }
+
+    /**
+     * @brief Get or register a gauge series
+     */
+    Gauge& gauge(const std::string& name, const std::string& help,
+                 const MetricLabels& labels = {}) {
+        return *find_or_create(name, help, Type::Gauge, labels).gauge;
+    }
+
+    /**
+     * @brief Render all families in OpenMetrics text format (terminated by # EOF)
+     */
+    [[nodiscard]] std::string render_openmetrics() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::string out;
+        for (const auto& family : families_) {
+            bool is_counter = family->type == Type::Counter;
+            out += "# TYPE " + family->name + (is_counter ? " counter\n" : " gauge\n");
+            out += "# HELP " + family->name + ' ';
+            append_escaped(out, family->help);
+            out += '\n';
+            for (const auto& s : family->series) {
+                out += family->name;
+                if (is_counter) out += "_total";
+                out += s.labels;
+                out += ' ';
+                if (is_counter) {
+                    out += std::to_string(s.counter->value());
+                } else {
+                    append_number(out, s.gauge->value());
+                }
+                out += '\n';
+            }
+        }
+        out += "# EOF\n";
+        return out;
+    }
+
+    /**
+     * @brief Answer a scrape on a local HTTP endpoint
+     *
+     * Transport-agnostic: the embedding service owns the socket and passes
+     * the request line (e.g. "GET /metrics HTTP/1.1"); the returned string
+     * is a complete HTTP/1.1 response.
+     */
+    [[nodiscard]] std::string handle_http_request(const std::string& request_line,
+                                                  const std::string& path = "/metrics") const {
+        std::string expected = "GET " + path;
+        bool match = request_line.compare(0, expected.size(), expected) == 0 &&
+                     (request_line.size() == expected.size() ||
+                      request_line[expected.size()] == ' ' ||
+                      request_line[expected.size()] == '?');
+        if (!match) {
+            return "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        }
+        std::string body = render_openmetrics();
+        return "HTTP/1.1 200 OK\r\n"
+               "Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"
+               "Content-Length: " + std::to_string(body.size()) + "\r\n"
+               "Connection: close\r\n\r\n" + body;
+    }
+};
+
+/**
+ * @brief Offload metrics pre-registered in a MetricsRegistry
+ */
+class OffloadMetrics {
+private:
+    MetricsRegistry registry_;
+
+public:
+    Counter& bytes_transferred;             ///< Bytes acknowledged by targets
+    Counter& offloads_started;              ///< Offloads started
+    Counter& offloads_succeeded;            ///< Offloads completed successfully
+    Counter& offloads_failed;               ///< Offloads failed or cancelled
+    Counter& segment_retries;               ///< Segment transfer retries
+    Gauge& segments_pending;                ///< Segments of the current offload by state
+    Gauge& segments_completed;
+    Gauge& segments_failed;
+
+    OffloadMetrics()
+        : bytes_transferred(registry_.counter(
+              "redcomponent_offload_bytes_transferred", "Bytes transferred to target nodes"))
+        , offloads_started(registry_.counter(
+              "redcomponent_offload_operations_started", "Offload operations started"))
+        , offloads_succeeded(registry_.counter(
+              "redcomponent_offload_operations", "Finished offload operations",
+              {{"result", "success"}}))
+        , offloads_failed(registry_.counter(
+              "redcomponent_offload_operations", "Finished offload operations",
+              {{"result", "failure"}}))
+        , segment_retries(registry_.counter(
+              "redcomponent_offload_segment_retries", "Segment transfer retries"))
+        , segments_pending(registry_.gauge(
+              "redcomponent_offload_segments", "Segments of the current offload by state",
+              {{"state", "pending"}}))
+        , segments_completed(registry_.gauge(
+              "redcomponent_offload_segments", "Segments of the current offload by state",
+              {{"state", "completed"}}))
+        , segments_failed(registry_.gauge(
+              "redcomponent_offload_segments", "Segments of the current offload by state",
+              {{"state", "failed"}})) {}
+
+    OffloadMetrics(const OffloadMetrics&) = delete;
+    OffloadMetrics& operator=(const OffloadMetrics&) = delete;
+
+    /**
+     * @brief Per-node active offload gauge (registered on first use)
+     */
+    Gauge& node_active_offloads(const std::string& node_id) {
+        return registry_.gauge("redcomponent_offload_node_active_offloads",
+                               "Active offloads on a target node", {{"node_id", node_id}});
+    }
+
+    [[nodiscard]] const MetricsRegistry& registry() const { return registry_; }
+    [[nodiscard]] MetricsRegistry& registry() { return registry_; }
+};
+
+} // namespace redcomponent::offloading
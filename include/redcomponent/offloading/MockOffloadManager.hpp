@@ -8,7 +8,21 @@
 #pragma once
 
 #include "IOffloadManager.hpp"
+#include "Topology.hpp"
+#include "StripePlanner.hpp"
+#include "OffloadPlanner.hpp"
+#include "RateEstimator.hpp"
+#include "LatencyHistogram.hpp"
+#include "MetricsRegistry.hpp"
+#include "Tracing.hpp"
+#include "ChangeTracker.hpp"
+#include "AdmissionControl.hpp"
+#include "SelectionPolicy.hpp"
+#include "HashRing.hpp"
+#include "LocationDirectory.hpp"
+#include "KeyFilter.hpp"
 #include <mutex>
+#include <map>
 #include <algorithm>
 
 namespace redcomponent::offloading {
@@ -28,9 +42,28 @@ private:
     OffloadConfig config_;
     OffloadStatus status_ = OffloadStatus::Idle;
     OffloadProgress progress_;
+    RateEstimator rate_estimator_;
+    SegmentLatencyMetrics segment_latency_;
+    std::map<std::string, std::unique_ptr<SegmentLatencyMetrics>> node_latency_;
+    OffloadMetrics metrics_;
+    Tracer tracer_;
+    std::chrono::steady_clock::time_point status_entered_at_;
     std::optional<TargetNode> current_target_;
+    StripePlan stripe_plan_;
+    std::shared_ptr<ChangeTracker> change_tracker_;
+    std::optional<DeltaPlan> delta_plan_;
+    std::shared_ptr<AdmissionRegistry> admission_;
+    std::optional<AdmissionLease> lease_;
+    std::optional<std::string> admitted_node_;
+    std::mt19937_64 selection_rng_{std::random_device{}()};
+    HashRing hash_ring_;
+    std::shared_ptr<LocationDirectory> location_directory_;
+    std::shared_ptr<NodeKeyFilters> key_filters_;
+    size_t data_ids_published_ = 0;
     std::optional<OffloadResult> last_result_;
     std::vector<TargetNode> available_nodes_;
+    TopologyModel topology_;
+    NodeLocation local_location_;
     mutable std::mutex mutex_;
 
     // Callbacks
@@ -44,26 +77,154 @@ private:
     std::function<bool()> cancel_hook_;
     std::function<std::vector<TargetNode>()> nodes_hook_;
     std::function<bool(const std::string&)> select_node_hook_;
+    std::function<std::chrono::steady_clock::time_point()> clock_;
+    std::function<std::optional<std::vector<std::byte>>(const TargetNode&)> filter_exchange_hook_;
 
     // Offload data tracking
     std::vector<std::string> offload_data_ids_;
 
+    std::chrono::steady_clock::time_point now() const {
+        return clock_ ? clock_() : std::chrono::steady_clock::now();
+    }
+
     void set_status(OffloadStatus new_status) {
         OffloadStatus old_status = status_;
         status_ = new_status;
+        if (old_status != new_status) {
+            trace_status_exit(old_status);
+        }
         if (status_change_callback_ && old_status != new_status) {
             status_change_callback_(old_status, new_status);
         }
     }
 
+    void plan_stripes() {
+        stripe_plan_ = StripePlan{};
+        if (config_.max_stripe_targets <= 1 || !current_target_) {
+            return;
+        }
+
+        // Current target first, then the eligible nodes with most spare bandwidth
+        std::vector<TargetNode> others;
+        for (const auto& node : available_nodes_) {
+            if (node.node_id != current_target_->node_id && node.can_accept_offload()) {
+                others.push_back(node);
+            }
+        }
+        std::stable_sort(others.begin(), others.end(),
+            [this](const TargetNode& a, const TargetNode& b) {
+                return topology_.spare_bandwidth(local_location_, a) >
+                       topology_.spare_bandwidth(local_location_, b);
+            });
+
+        std::vector<TargetNode> stripes{*current_target_};
+        for (auto& node : others) {
+            if (stripes.size() >= config_.max_stripe_targets) break;
+            stripes.push_back(std::move(node));
+        }
+
+        std::vector<double> bandwidth;
+        for (const auto& node : stripes) {
+            bandwidth.push_back(topology_.spare_bandwidth(local_location_, node));
+        }
+        stripe_plan_ = StripePlanner::plan(
+            stripes, bandwidth, progress_.total_bytes, config_.segment_size);
+    }
+
+    void trace_status_exit(OffloadStatus old_status) {
+        auto now = this->now();
+        switch (old_status) {
+            case OffloadStatus::Preparing:
+                tracer_.record(SpanKind::Preparing, status_entered_at_, now);
+                break;
+            case OffloadStatus::Transferring:
+                tracer_.record(SpanKind::Transferring, status_entered_at_, now);
+                break;
+            case OffloadStatus::Completing:
+                tracer_.record(SpanKind::Completing, status_entered_at_, now);
+                break;
+            default:
+                break;
+        }
+        status_entered_at_ = now;
+    }
+
+    void adjust_active_offloads(const std::string& node_id, bool increment) {
+        auto adjust = [increment](TargetNode& node) {
+            if (increment) {
+                node.active_offload_count++;
+            } else if (node.active_offload_count > 0) {
+                node.active_offload_count--;
+            }
+        };
+        for (auto& node : available_nodes_) {
+            if (node.node_id == node_id) adjust(node);
+        }
+        if (current_target_ && current_target_->node_id == node_id) {
+            adjust(*current_target_);
+        }
+        publish_node_metrics();
+    }
+
+    bool admit() {
+        if (admitted_node_) {
+            return true;    // Resumed offload keeps its slot
+        }
+        if (admission_) {
+            lease_ = admission_->target(*current_target_).try_acquire(now());
+            if (!lease_) {
+                notify_error("Target " + current_target_->node_id + " rejected admission");
+                return false;
+            }
+        }
+        admitted_node_ = current_target_->node_id;
+        adjust_active_offloads(*admitted_node_, true);
+        return true;
+    }
+
+    void release_admission() {
+        if (!admitted_node_) return;
+        adjust_active_offloads(*admitted_node_, false);
+        if (admission_ && lease_) {
+            admission_->release(*lease_);
+        }
+        lease_.reset();
+        admitted_node_.reset();
+    }
+
+    // Data ids are laid out over segments in order; each is added to the
+    // target's key filter once the segment holding its end completes
+    void publish_completed_data_ids(bool all) {
+        if (!key_filters_ || !current_target_) return;
+        size_t ids = offload_data_ids_.size();
+        while (data_ids_published_ < ids &&
+               (all || progress_.segments_completed * ids >=
+                       (data_ids_published_ + 1) * progress_.segments_total)) {
+            key_filters_->add(current_target_->node_id, offload_data_ids_[data_ids_published_++]);
+        }
+    }
+
     void notify_error(const std::string& error) {
         if (error_callback_) {
             error_callback_(error);
         }
     }
 
-    void notify_progress() {
-        progress_.last_update = std::chrono::steady_clock::now();
+    void publish_segment_metrics() {
+        metrics_.segments_pending.set(static_cast<double>(progress_.segments_pending));
+        metrics_.segments_completed.set(static_cast<double>(progress_.segments_completed));
+        metrics_.segments_failed.set(static_cast<double>(progress_.segments_failed));
+    }
+
+    void publish_node_metrics() {
+        for (const auto& node : available_nodes_) {
+            metrics_.node_active_offloads(node.node_id).set(
+                static_cast<double>(node.active_offload_count));
+        }
+    }
+
+    void notify_progress(std::chrono::steady_clock::time_point now) {
+        progress_.last_update = now;
         if (progress_.start_time.time_since_epoch().count() > 0) {
             progress_.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
                 progress_.last_update - progress_.start_time);
@@ -77,13 +238,24 @@ private:
         OffloadResult result;
         result.success = success;
         result.final_progress = progress_;
-        result.completed_at = std::chrono::steady_clock::now();
+        result.completed_at = now();
         if (current_target_) {
             result.target_node = *current_target_;
         }
         if (!success && progress_.error_message) {
             result.error_message = progress_.error_message;
         }
+        (success ? metrics_.offloads_succeeded : metrics_.offloads_failed).inc();
+        if (success) {
+            publish_completed_data_ids(true);
+        }
+        if (success && current_target_ && location_directory_) {
+            for (const auto& data_id : offload_data_ids_) {
+                location_directory_->record(data_id, current_target_->node_id);
+            }
+        }
+        release_admission();
+        publish_segment_metrics();
         last_result_ = result;
         if (complete_callback_) {
             complete_callback_(result);
@@ -125,10 +297,17 @@ public:
     bool refresh_nodes() override {
         std::lock_guard<std::mutex> lock(mutex_);
         // Mock: just update health check timestamps
-        auto now = std::chrono::steady_clock::now();
+        auto now = this->now();
         for (auto& node : available_nodes_) {
             node.last_health_check = now;
+            // Health checks carry each target's key filter summary
+            if (key_filters_ && filter_exchange_hook_) {
+                if (auto summary = filter_exchange_hook_(node)) {
+                    key_filters_->merge_remote(node.node_id, *summary);
+                }
+            }
         }
+        publish_node_metrics();
         return true;
     }
 
@@ -156,18 +335,58 @@ public:
     bool auto_select_target_node() override {
         std::lock_guard<std::mutex> lock(mutex_);
 
-        // Find best node (most available storage, healthy, can accept)
-        TargetNode* best = nullptr;
-        for (auto& node : available_nodes_) {
-            if (node.can_accept_offload()) {
-                if (!best || node.available_storage_bytes > best->available_storage_bytes) {
-                    best = &node;
+        auto in_local_region = [this](const TargetNode& n) {
+            return n.region == local_location_.region;
+        };
+        auto eligible = [this](const TargetNode& n) {
+            return n.can_accept_offload() &&
+                   (!admission_ || admission_->target(n).has_capacity(now()));
+        };
+        auto transfer_time = [this](const TargetNode& n) {
+            return topology_.expected_transfer_time(
+                local_location_, n, config_.min_byte_difference, config_);
+        };
+        // Lowest expected transfer time, then most available storage
+        auto faster = [&](const TargetNode& a, const TargetNode& b) {
+            auto ta = transfer_time(a);
+            auto tb = transfer_time(b);
+            return ta < tb ||
+                   (ta == tb && a.available_storage_bytes > b.available_storage_bytes);
+        };
+        bool prefer_local = config_.prefer_local_region && !local_location_.region.empty();
+
+        std::optional<size_t> best;
+        if (config_.selection_choices > 0) {
+            // Power-of-d-choices: O(d); local region ranks first instead of filtering
+            best = PowerOfChoices::select(available_nodes_.size(), config_.selection_choices,
+                selection_rng_,
+                [&](size_t i) { return eligible(available_nodes_[i]); },
+                [&](size_t i, size_t j) {
+                    const auto& a = available_nodes_[i];
+                    const auto& b = available_nodes_[j];
+                    if (prefer_local && in_local_region(a) != in_local_region(b)) {
+                        return in_local_region(a);
+                    }
+                    return faster(a, b);
+                });
+        } else {
+            // Restrict to the local region when preferred and possible
+            bool local_only = prefer_local &&
+                std::any_of(available_nodes_.begin(), available_nodes_.end(),
+                    [&](const TargetNode& n) { return n.can_accept_offload() && in_local_region(n); });
+
+            for (size_t i = 0; i < available_nodes_.size(); ++i) {
+                const auto& node = available_nodes_[i];
+                if (!eligible(node)) continue;
+                if (local_only && !in_local_region(node)) continue;
+                if (!best || faster(node, available_nodes_[*best])) {
+                    best = i;
                 }
             }
         }
 
         if (best) {
-            current_target_ = *best;
+            current_target_ = available_nodes_[*best];
             return true;
         }
 
@@ -210,14 +429,32 @@ public:
             return false;
         }
 
+        if (!admit()) {
+            return false;
+        }
+
         // Initialize progress
         offload_data_ids_ = data_ids;
+        data_ids_published_ = 0;
         progress_ = OffloadProgress{};
-        progress_.start_time = std::chrono::steady_clock::now();
+        progress_.start_time = now();
         progress_.total_bytes = 100 * 1024 * 1024; // Mock: 100MB
         progress_.pending_bytes = progress_.total_bytes;
         progress_.segments_total = 100;
         progress_.segments_pending = 100;
+        delta_plan_.reset();
+        if (change_tracker_) {
+            // Delta offload: only pages changed since the last offload to this target
+            delta_plan_ = change_tracker_->plan(current_target_->node_id);
+            progress_.total_bytes = delta_plan_->bytes;
+            progress_.pending_bytes = delta_plan_->bytes;
+            progress_.segments_total = delta_plan_->pages.size();
+            progress_.segments_pending = delta_plan_->pages.size();
+        }
+        rate_estimator_.start(progress_.start_time);
+        plan_stripes();
+        metrics_.offloads_started.inc();
+        publish_segment_metrics();
 
         set_status(OffloadStatus::Preparing);
         set_status(OffloadStatus::Transferring);
@@ -377,6 +614,201 @@ public:
         select_node_hook_ = std::move(hook);
     }
 
+    /**
+     * @brief Plan placement of sized data items across the available nodes
+     * @param items Data items with sizes
+     * @return PlacementPlan minimizing expected makespan
+     */
+    [[nodiscard]] PlacementPlan plan_offload(const std::vector<DataItem>& items) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::vector<double> bandwidth;
+        for (const auto& node : available_nodes_) {
+            bandwidth.push_back(topology_.spare_bandwidth(local_location_, node));
+        }
+        return OffloadPlanner::plan(items, available_nodes_, bandwidth);
+    }
+
+    /**
+     * @brief Get stripe plan of the current offload (empty when not striped)
+     */
+    [[nodiscard]] StripePlan get_stripe_plan() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stripe_plan_;
+    }
+
+    /**
+     * @brief Track changes of the offloaded data for delta offloads
+     * @param tracker Change tracker (nullptr = always full offloads)
+     */
+    void set_change_tracker(std::shared_ptr<ChangeTracker> tracker) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        change_tracker_ = std::move(tracker);
+    }
+
+    /**
+     * @brief Get delta plan of the current offload (none without a change tracker)
+     */
+    [[nodiscard]] std::optional<DeltaPlan> get_delta_plan() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return delta_plan_;
+    }
+
+    /**
+     * @brief Request admission leases from targets before offloading
+     * @param registry Admission state shared by all sources (nullptr = no admission control)
+     */
+    void set_admission_registry(std::shared_ptr<AdmissionRegistry> registry) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        admission_ = std::move(registry);
+    }
+
+    /**
+     * @brief Get admission lease held by the current offload
+     */
+    [[nodiscard]] std::optional<AdmissionLease> get_admission_lease() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lease_;
+    }
+
+    /**
+     * @brief Seed this manager's target selection RNG (for reproducible tests)
+     */
+    void set_selection_seed(uint64_t seed) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        selection_rng_.seed(seed);
+    }
+
+    /**
+     * @brief Set hash ring tuning used by select_target_for_data (clears placed loads)
+     */
+    void set_hash_ring_options(const HashRingOptions& options) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hash_ring_ = HashRing(options);
+    }
+
+    /**
+     * @brief Select the target owning @p data_id on the consistent hash ring
+     *
+     * Ring membership follows the healthy, accepting nodes, so only data
+     * on joining or leaving nodes changes owner. @p bytes count towards
+     * the node's bounded load.
+     */
+    bool select_target_for_data(const std::string& data_id, size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<TargetNode> members;
+        for (const auto& node : available_nodes_) {
+            if (node.accepting_offloads && node.health == NodeHealth::Healthy) {
+                members.push_back(node);
+            }
+        }
+        hash_ring_.rebuild(members);
+
+        auto owner = hash_ring_.place(data_id, bytes);
+        if (!owner) {
+            notify_error("No suitable target node available");
+            return false;
+        }
+        for (const auto& node : available_nodes_) {
+            if (node.node_id == *owner) {
+                current_target_ = node;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Get placement hash ring
+     */
+    [[nodiscard]] HashRing get_hash_ring() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hash_ring_;
+    }
+
+    /**
+     * @brief Record completed offloads' data ids in @p directory (nullptr disables)
+     */
+    void set_location_directory(std::shared_ptr<LocationDirectory> directory) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        location_directory_ = std::move(directory);
+    }
+
+    /**
+     * @brief Get location directory (nullptr if none is set)
+     */
+    [[nodiscard]] std::shared_ptr<LocationDirectory> get_location_directory() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return location_directory_;
+    }
+
+    /**
+     * @brief Add offloaded data ids to per-node key filters (nullptr disables)
+     */
+    void set_key_filters(std::shared_ptr<NodeKeyFilters> filters) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        key_filters_ = std::move(filters);
+    }
+
+    /**
+     * @brief Get key filters (nullptr if none are set)
+     */
+    [[nodiscard]] std::shared_ptr<NodeKeyFilters> get_key_filters() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return key_filters_;
+    }
+
+    /**
+     * @brief Set the summary a node returns in refresh_nodes() health checks
+     *
+     * Returning nullopt keeps the local summary of that node.
+     */
+    void set_filter_exchange_hook(
+        std::function<std::optional<std::vector<std::byte>>(const TargetNode&)> hook) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        filter_exchange_hook_ = std::move(hook);
+    }
+
+    /**
+     * @brief Set topology model used for target selection
+     */
+    void set_topology(const TopologyModel& topology) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        topology_ = topology;
+    }
+
+    /**
+     * @brief Get topology model used for target selection
+     */
+    [[nodiscard]] TopologyModel get_topology() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return topology_;
+    }
+
+    /**
+     * @brief Set location of the local (source) node
+     */
+    void set_local_location(const NodeLocation& location) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        local_location_ = location;
+    }
+
+    /**
+     * @brief Replace the wall clock (e.g. with a simulator's virtual clock)
+     * @param clock Time source; nullptr restores steady_clock::now
+     */
+    void set_clock(std::function<std::chrono::steady_clock::time_point()> clock) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        clock_ = std::move(clock);
+    }
+
+    /**
+     * @brief Get current time of the mock's clock
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point get_time() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return now();
+    }
+
     /**
      * @brief Force a specific status
      */
@@ -390,6 +822,15 @@ public:
      * @param bytes Number of bytes transferred
      */
     void simulate_progress(size_t bytes) {
+        simulate_progress(bytes, get_time());
+    }
+
+    /**
+     * @brief Simulate progress update at a given time
+     * @param bytes Number of bytes transferred (one segment)
+     * @param now Segment completion timestamp
+     */
+    void simulate_progress(size_t bytes, std::chrono::steady_clock::time_point now) {
         std::lock_guard<std::mutex> lock(mutex_);
 
         progress_.transferred_bytes += bytes;
@@ -397,19 +838,85 @@ public:
         progress_.segments_completed++;
         progress_.segments_pending = progress_.segments_total - progress_.segments_completed;
 
-        // Calculate transfer rate
-        auto now = std::chrono::steady_clock::now();
-        if (progress_.start_time.time_since_epoch().count() > 0) {
-            auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
-                now - progress_.start_time).count();
-            if (elapsed > 0) {
-                progress_.average_bytes_per_second =
-                    static_cast<double>(progress_.transferred_bytes) / elapsed;
+        // Update transfer rate
+        rate_estimator_.record(bytes, now);
+        progress_.bytes_per_second = rate_estimator_.window_rate();
+        progress_.average_bytes_per_second = rate_estimator_.average_rate();
+        progress_.smoothed_bytes_per_second = rate_estimator_.ewma_rate();
+        metrics_.bytes_transferred.inc(bytes);
+        publish_segment_metrics();
+        publish_completed_data_ids(false);
+
+        notify_progress(now);
+    }
+
+    /**
+     * @brief Simulate timings of a completed segment on the current target
+     * @param transfer Send-to-ack latency
+     * @param queue_wait Time queued before transfer started
+     * @param verification Integrity verification time
+     */
+    void simulate_segment_timing(std::chrono::microseconds transfer,
+                                 std::chrono::microseconds queue_wait,
+                                 std::chrono::microseconds verification) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        segment_latency_.record(transfer, queue_wait, verification);
+
+        // Send and verify spans laid out back to back, ending now
+        auto end = now();
+        auto verify_start = end - verification;
+        tracer_.record(SpanKind::SegmentSend, verify_start - transfer, verify_start,
+                       progress_.segments_completed);
+        tracer_.record(SpanKind::SegmentVerify, verify_start, end,
+                       progress_.segments_completed);
+
+        if (current_target_) {
+            auto& node_metrics = node_latency_[current_target_->node_id];
+            if (!node_metrics) {
+                node_metrics = std::make_unique<SegmentLatencyMetrics>();
+            }
+            node_metrics->record(transfer, queue_wait, verification);
+            if (admission_) {
+                admission_->target(*current_target_).record_latency(transfer);
             }
         }
-        progress_.bytes_per_second = static_cast<double>(bytes);
+    }
+
+    /**
+     * @brief Get segment latency histograms, overall and per target node
+     */
+    [[nodiscard]] OffloadMetricsSnapshot get_metrics_snapshot() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        OffloadMetricsSnapshot snapshot;
+        snapshot.segments = segment_latency_.snapshot();
+        for (const auto& [node_id, metrics] : node_latency_) {
+            snapshot.per_node[node_id] = metrics->snapshot();
+        }
+        snapshot.taken_at = now();
+        return snapshot;
+    }
 
-        notify_progress();
+    /**
+     * @brief Simulate a segment transfer retry
+     */
+    void simulate_segment_retry() {
+        metrics_.segment_retries.inc();
+    }
+
+    /**
+     * @brief Get lifecycle tracer (disabled by default; thread-safe)
+     */
+    [[nodiscard]] Tracer& tracer() {
+        return tracer_;
+    }
+
+    /**
+     * @brief Get offload metrics (lock-free; does not take the manager lock)
+     */
+    [[nodiscard]] const OffloadMetrics& metrics() const {
+        return metrics_;
     }
 
     /**
@@ -424,6 +931,9 @@ public:
             progress_.pending_bytes = 0;
             progress_.segments_completed = progress_.segments_total;
             progress_.segments_pending = 0;
+            if (change_tracker_ && delta_plan_) {
+                change_tracker_->commit(*delta_plan_);
+            }
             set_status(OffloadStatus::Completing);
             set_status(OffloadStatus::Completed);
         } else {
@@ -502,15 +1012,32 @@ public:
 
         status_ = OffloadStatus::Idle;
         progress_ = OffloadProgress{};
+        rate_estimator_ = RateEstimator{};
+        segment_latency_.reset();
+        node_latency_.clear();
         current_target_.reset();
+        stripe_plan_ = StripePlan{};
+        change_tracker_.reset();
+        delta_plan_.reset();
+        admission_.reset();
+        lease_.reset();
+        admitted_node_.reset();
+        hash_ring_ = HashRing{};
+        location_directory_.reset();
+        key_filters_.reset();
+        data_ids_published_ = 0;
         last_result_.reset();
         offload_data_ids_.clear();
+        topology_ = TopologyModel{};
+        local_location_ = NodeLocation{};
 
         // Clear hooks
         start_hook_ = nullptr;
         cancel_hook_ = nullptr;
         nodes_hook_ = nullptr;
         select_node_hook_ = nullptr;
+        clock_ = nullptr;
+        filter_exchange_hook_ = nullptr;
 
         // Reset nodes to default
         available_nodes_ = {
@@ -0,0 +1,163 @@
+/**
+ * @file OffloadPlanner.hpp
+ * @brief Bin-Packing Placement Planner for Multi-Shard Offloads
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "IOffloadManager.hpp"
+#include <string>
+#include <vector>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief A unit of data to offload with its size
+ */
+struct DataItem {
+    std::string data_id;                    ///< Data identifier
+    size_t size_bytes = 0;                  ///< Size of the data in bytes
+};
+
+/**
+ * @brief Placement of one data item on a target node
+ */
+struct Placement {
+    std::string data_id;                    ///< Data identifier
+    std::string node_id;                    ///< Target node identifier
+    size_t size_bytes = 0;                  ///< Size of the data in bytes
+    size_t round = 0;                       ///< Zero-based round (wave) on its slot
+    double start_seconds = 0.0;             ///< Expected start time
+    double finish_seconds = 0.0;            ///< Expected finish time
+};
+
+/**
+ * @brief Result of planning a multi-shard offload
+ */
+struct PlacementPlan {
+    std::vector<Placement> placements;      ///< Placed items, largest first
+    std::vector<DataItem> unplaced;         ///< Items no node had storage for
+    size_t rounds = 0;                      ///< Maximum rounds on any slot
+    double makespan_seconds = 0.0;          ///< Expected time until all items land
+
+    /**
+     * @brief Check if every item was placed
+     */
+    [[nodiscard]] bool complete() const {
+        return unplaced.empty();
+    }
+
+    /**
+     * @brief Get data ids placed on a node, in start order
+     */
+    [[nodiscard]] std::vector<std::string> data_ids_for(const std::string& node_id) const {
+        std::vector<const Placement*> matches;
+        for (const auto& p : placements) {
+            if (p.node_id == node_id) matches.push_back(&p);
+        }
+        std::stable_sort(matches.begin(), matches.end(),
+            [](const Placement* a, const Placement* b) {
+                return a->start_seconds < b->start_seconds;
+            });
+        std::vector<std::string> ids;
+        for (const auto* p : matches) ids.push_back(p->data_id);
+        return ids;
+    }
+};
+
+/**
+ * @brief Makespan-minimizing placement of data items onto target nodes
+ *
+ * Each node contributes (max_concurrent_offloads - active_offload_count)
+ * parallel slots that share its spare bandwidth. Items are placed
+ * largest-first onto the slot that would finish them earliest (LPT),
+ * skipping nodes whose available_storage_bytes would be exceeded. LPT is
+ * within 4/3 of the optimal makespan on uniform slots and keeps the
+ * number of rounds per slot balanced.
+ */
+class OffloadPlanner {
+public:
+    /**
+     * @brief Plan placement of @p items
+     * @param items Data items with sizes
+     * @param nodes Eligible target nodes
+     * @param spare_bandwidth Spare bandwidth per node (bytes/s), same order as @p nodes
+     */
+    [[nodiscard]] static PlacementPlan plan(
+        const std::vector<DataItem>& items,
+        const std::vector<TargetNode>& nodes,
+        const std::vector<double>& spare_bandwidth) {
+        PlacementPlan result;
+        if (spare_bandwidth.size() != nodes.size()) {
+            result.unplaced = items;
+            return result;
+        }
+
+        struct Slot {
+            size_t node;
+            double rate;
+            double finish = 0.0;
+            size_t rounds = 0;
+        };
+        std::vector<Slot> slots;
+        std::vector<size_t> remaining_storage;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            remaining_storage.push_back(nodes[i].available_storage_bytes);
+            const auto& node = nodes[i];
+            if (!node.can_accept_offload() || spare_bandwidth[i] <= 0.0) continue;
+            size_t free_slots = node.max_concurrent_offloads - node.active_offload_count;
+            for (size_t k = 0; k < free_slots; ++k) {
+                slots.push_back({i, spare_bandwidth[i] / free_slots});
+            }
+        }
+
+        std::vector<size_t> order(items.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&items](size_t a, size_t b) {
+            return items[a].size_bytes > items[b].size_bytes;
+        });
+
+        for (size_t idx : order) {
+            const auto& item = items[idx];
+            size_t best = std::numeric_limits<size_t>::max();
+            double best_finish = 0.0;
+            for (size_t s = 0; s < slots.size(); ++s) {
+                if (remaining_storage[slots[s].node] < item.size_bytes) continue;
+                double finish = slots[s].finish + item.size_bytes / slots[s].rate;
+                if (best == std::numeric_limits<size_t>::max() || finish < best_finish) {
+                    best = s;
+                    best_finish = finish;
+                }
+            }
+
+            if (best == std::numeric_limits<size_t>::max()) {
+                result.unplaced.push_back(item);
+                continue;
+            }
+
+            auto& slot = slots[best];
+            Placement placement;
+            placement.data_id = item.data_id;
+            placement.node_id = nodes[slot.node].node_id;
+            placement.size_bytes = item.size_bytes;
+            placement.round = slot.rounds++;
+            placement.start_seconds = slot.finish;
+            placement.finish_seconds = best_finish;
+            slot.finish = best_finish;
+            remaining_storage[slot.node] -= item.size_bytes;
+
+            result.rounds = std::max(result.rounds, slot.rounds);
+            result.makespan_seconds = std::max(result.makespan_seconds, best_finish);
+            result.placements.push_back(std::move(placement));
+        }
+
+        return result;
+    }
+};
+
+} // namespace redcomponent::offloading
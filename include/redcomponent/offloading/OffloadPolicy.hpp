@@ -0,0 +1,68 @@
+/**
+ * @file OffloadPolicy.hpp
+ * @brief Auto-Trigger and Retry Policy derived from OffloadConfig
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "IOffloadManager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Resource usage of the local (source) node at one point in time
+ */
+struct ResourceSample {
+    double memory_usage_percent = 0.0;      ///< Memory utilization
+    double storage_usage_percent = 0.0;     ///< Storage utilization
+    double cpu_usage_percent = 0.0;         ///< CPU utilization
+};
+
+/**
+ * @brief Decisions an offload engine takes from OffloadConfig
+ *
+ * Stateless; shared by the engine and the cluster simulator so both
+ * evaluate exactly the same thresholds and backoff schedule.
+ */
+class OffloadPolicy {
+public:
+    /**
+     * @brief Whether the local node should start an automatic offload
+     */
+    [[nodiscard]] static bool should_trigger(const ResourceSample& sample,
+                                             const OffloadConfig& config) {
+        return config.auto_offload &&
+               (sample.memory_usage_percent >= config.memory_threshold_percent ||
+                sample.storage_usage_percent >= config.storage_threshold_percent);
+    }
+
+    /**
+     * @brief Whether a segment that failed @p attempts times may be retried
+     */
+    [[nodiscard]] static bool may_retry(size_t attempts, const OffloadConfig& config) {
+        return attempts < config.max_retries;
+    }
+
+    /**
+     * @brief Delay before retry number @p attempt (1-based)
+     *
+     * retry_delay * retry_backoff_multiplier^(attempt - 1), capped at
+     * transfer_timeout.
+     */
+    [[nodiscard]] static std::chrono::milliseconds retry_delay(size_t attempt,
+                                                               const OffloadConfig& config) {
+        double factor = std::pow(std::max(config.retry_backoff_multiplier, 1.0),
+                                 static_cast<double>(attempt > 0 ? attempt - 1 : 0));
+        double ms = static_cast<double>(config.retry_delay.count()) * factor;
+        double cap = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(config.transfer_timeout).count());
+        return std::chrono::milliseconds{static_cast<int64_t>(std::min(ms, cap))};
+    }
+};
+
+} // namespace redcomponent::offloading
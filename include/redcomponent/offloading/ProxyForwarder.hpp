@@ -0,0 +1,392 @@
+/**
+ * @file ProxyForwarder.hpp
+ * @brief Batched, Pipelined Proxy-Mode Request Forwarding
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "SegmentFrame.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Outcome of a forwarded request
+ */
+enum class ForwardStatus : uint8_t {
+    Ok,                 ///< Target served the request
+    NotFound,           ///< Target does not hold the data
+    Failed,             ///< Target failed to serve the request
+    ConnectionLost      ///< Batch could not be sent or the connection dropped
+};
+
+/**
+ * @brief Convert ForwardStatus to string
+ */
+inline std::string to_string(ForwardStatus status) {
+    switch (status) {
+        case ForwardStatus::Ok:             return "Ok";
+        case ForwardStatus::NotFound:       return "NotFound";
+        case ForwardStatus::Failed:         return "Failed";
+        case ForwardStatus::ConnectionLost: return "ConnectionLost";
+        default:                            return "Unknown";
+    }
+}
+
+/**
+ * @brief One request or response inside a decoded batch (views into the frame)
+ */
+struct ForwardEntry {
+    uint64_t correlation_id = 0;
+    ForwardStatus status = ForwardStatus::Ok;
+    std::string_view data_id;
+    std::span<const std::byte> body;
+};
+
+/**
+ * @brief Batch wire encoding
+ *
+ * A batch is the payload of one SegmentFrame (segment_id = batch
+ * sequence), so it shares the frame's versioning and CRC32C. Payload
+ * (little-endian): kind u8, reserved u8, count u16, then per entry
+ * correlation id u64, status u8, id length u16, body length u32, id
+ * bytes, body bytes (15 bytes of framing per request).
+ */
+struct ForwardBatchCodec {
+    enum class Kind : uint8_t { Request = 1, Response = 2 };
+
+    static constexpr size_t kBatchHeaderSize = 4;
+    static constexpr size_t kEntryHeaderSize = 15;
+    static constexpr size_t kMaxEntries = 0xFFFF;
+
+    static void begin(std::vector<std::byte>& out, Kind kind) {
+        out.clear();
+        out.resize(kBatchHeaderSize);
+        out[0] = static_cast<std::byte>(kind);
+    }
+
+    static void append(std::vector<std::byte>& out, uint64_t correlation_id, ForwardStatus status,
+                       std::string_view data_id, std::span<const std::byte> body) {
+        size_t at = out.size();
+        out.resize(at + kEntryHeaderSize + data_id.size() + body.size());
+        std::byte* p = out.data() + at;
+        detail::store_le(p, correlation_id, 8);
+        detail::store_le(p + 8, static_cast<uint8_t>(status), 1);
+        detail::store_le(p + 9, data_id.size(), 2);
+        detail::store_le(p + 11, body.size(), 4);
+        std::memcpy(p + kEntryHeaderSize, data_id.data(), data_id.size());
+        if (!body.empty()) {
+            std::memcpy(p + kEntryHeaderSize + data_id.size(), body.data(), body.size());
+        }
+        uint16_t count = static_cast<uint16_t>(detail::load_le(out.data() + 2, 2)) + 1;
+        detail::store_le(out.data() + 2, count, 2);
+    }
+
+    [[nodiscard]] static size_t count(std::span<const std::byte> batch) {
+        return batch.size() < kBatchHeaderSize ? 0 : detail::load_le(batch.data() + 2, 2);
+    }
+
+    /**
+     * @brief Decode a batch payload
+     * @return nullopt if it is truncated or of the other kind
+     */
+    [[nodiscard]] static std::optional<std::vector<ForwardEntry>> decode(
+        std::span<const std::byte> batch, Kind kind) {
+        if (batch.size() < kBatchHeaderSize || batch[0] != static_cast<std::byte>(kind)) {
+            return std::nullopt;
+        }
+        std::vector<ForwardEntry> entries(count(batch));
+        size_t pos = kBatchHeaderSize;
+        for (auto& entry : entries) {
+            if (batch.size() - pos < kEntryHeaderSize) return std::nullopt;
+            const std::byte* p = batch.data() + pos;
+            entry.correlation_id = detail::load_le(p, 8);
+            entry.status = static_cast<ForwardStatus>(detail::load_le(p + 8, 1));
+            size_t id_len = detail::load_le(p + 9, 2);
+            size_t body_len = detail::load_le(p + 11, 4);
+            pos += kEntryHeaderSize;
+            if (batch.size() - pos < id_len + body_len) return std::nullopt;
+            entry.data_id = {reinterpret_cast<const char*>(batch.data() + pos), id_len};
+            entry.body = batch.subspan(pos + id_len, body_len);
+            pos += id_len + body_len;
+        }
+        if (pos != batch.size()) return std::nullopt;
+        return entries;
+    }
+};
+
+/**
+ * @brief Forwarder tuning
+ */
+struct ProxyForwarderOptions {
+    size_t max_batch_requests = 64;         ///< Flush once this many requests are pending
+    size_t max_batch_bytes = 256 * 1024;    ///< Flush once the batch payload reaches this size
+    std::chrono::microseconds max_batch_delay{50}; ///< poll() flushes requests older than this
+    size_t max_in_flight = 4096;            ///< Requests sent but unanswered (backpressure)
+};
+
+/**
+ * @brief Forwarder counters
+ */
+struct ProxyForwarderStats {
+    size_t requests = 0;
+    size_t batches = 0;
+    size_t responses = 0;
+    size_t rejected = 0;                    ///< forward() calls refused by max_in_flight
+    size_t lost = 0;                        ///< Requests failed with ConnectionLost
+
+    [[nodiscard]] double requests_per_batch() const {
+        return batches == 0 ? 0.0 : static_cast<double>(requests) / static_cast<double>(batches);
+    }
+};
+
+/**
+ * @brief Forwards client requests to the node holding their data (proxy mode)
+ *
+ * Requests are appended to an open batch and shipped as one frame once
+ * the batch is full or max_batch_delay old, so many small requests share
+ * one write. Batches are pipelined: the forwarder never waits for a
+ * response before sending the next batch, and responses, matched by
+ * per-request correlation ids, may return in any order and in different
+ * batches. A request therefore costs its share of a write plus the
+ * target's service time instead of a dedicated round trip. The sink
+ * writes one frame to the (pooled) connection; responses are fed back
+ * through on_response(). Callbacks run outside the lock and may forward
+ * again. Thread-safe.
+ */
+class ProxyForwarder {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void(ForwardStatus, std::span<const std::byte> body)>;
+    using Sink = std::function<bool(std::span<const std::byte> frame)>;
+
+private:
+    struct Pending {
+        uint64_t correlation_id;
+        Callback callback;
+    };
+
+    mutable std::mutex mutex_;
+    Sink sink_;
+    ProxyForwarderOptions options_;
+    std::function<Clock::time_point()> clock_;
+    std::vector<std::byte> batch_;
+    std::vector<Pending> batch_requests_;
+    std::optional<Clock::time_point> batch_opened_;
+    std::map<uint64_t, Callback> in_flight_;
+    uint64_t next_correlation_id_ = 1;
+    uint64_t next_batch_id_ = 1;
+    ProxyForwarderStats stats_;
+
+    // Under mutex_: seal the open batch into a frame and register its requests
+    [[nodiscard]] std::optional<std::pair<std::vector<std::byte>, std::vector<uint64_t>>> seal() {
+        if (batch_requests_.empty()) return std::nullopt;
+        auto wire = make_frame(next_batch_id_++, 0, SegmentCodec::None, batch_,
+                               crc32c(batch_)).flatten();
+
+        std::vector<uint64_t> ids;
+        ids.reserve(batch_requests_.size());
+        for (auto& request : batch_requests_) {
+            ids.push_back(request.correlation_id);
+            in_flight_.emplace(request.correlation_id, std::move(request.callback));
+        }
+        batch_requests_.clear();
+        ForwardBatchCodec::begin(batch_, ForwardBatchCodec::Kind::Request);
+        batch_opened_.reset();
+        stats_.batches++;
+        return std::make_pair(std::move(wire), std::move(ids));
+    }
+
+    void send(std::optional<std::pair<std::vector<std::byte>, std::vector<uint64_t>>> sealed) {
+        if (!sealed || sink_(sealed->first)) return;
+
+        std::vector<Callback> failed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (uint64_t id : sealed->second) {
+                auto it = in_flight_.find(id);
+                if (it == in_flight_.end()) continue;
+                failed.push_back(std::move(it->second));
+                in_flight_.erase(it);
+            }
+            stats_.lost += failed.size();
+        }
+        for (auto& callback : failed) {
+            if (callback) callback(ForwardStatus::ConnectionLost, {});
+        }
+    }
+
+public:
+    /**
+     * @brief Construct forwarder
+     * @param sink Writes one frame to the target connection; false if the write failed
+     * @param options Tuning
+     * @param clock Time source (injectable for tests)
+     */
+    explicit ProxyForwarder(Sink sink, const ProxyForwarderOptions& options = {},
+                            std::function<Clock::time_point()> clock = Clock::now)
+        : sink_(std::move(sink)), options_(options), clock_(std::move(clock)) {
+        ForwardBatchCodec::begin(batch_, ForwardBatchCodec::Kind::Request);
+    }
+
+    /**
+     * @brief Queue a request for forwarding
+     * @return Correlation id, or nullopt if max_in_flight requests are outstanding
+     */
+    std::optional<uint64_t> forward(std::string_view data_id, std::span<const std::byte> body,
+                                    Callback callback) {
+        std::optional<std::pair<std::vector<std::byte>, std::vector<uint64_t>>> sealed;
+        uint64_t id;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (in_flight_.size() + batch_requests_.size() >= options_.max_in_flight) {
+                stats_.rejected++;
+                return std::nullopt;
+            }
+            id = next_correlation_id_++;
+            ForwardBatchCodec::append(batch_, id, ForwardStatus::Ok, data_id, body);
+            batch_requests_.push_back({id, std::move(callback)});
+            if (!batch_opened_) batch_opened_ = clock_();
+            stats_.requests++;
+            if (batch_requests_.size() >= std::min(options_.max_batch_requests,
+                                                   ForwardBatchCodec::kMaxEntries) ||
+                batch_.size() >= options_.max_batch_bytes) {
+                sealed = seal();
+            }
+        }
+        send(std::move(sealed));
+        return id;
+    }
+
+    /**
+     * @brief Send the open batch now
+     */
+    void flush() {
+        std::optional<std::pair<std::vector<std::byte>, std::vector<uint64_t>>> sealed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            sealed = seal();
+        }
+        send(std::move(sealed));
+    }
+
+    /**
+     * @brief Flush the open batch if it is older than max_batch_delay (call from the event loop)
+     */
+    void poll() {
+        std::optional<std::pair<std::vector<std::byte>, std::vector<uint64_t>>> sealed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (batch_opened_ && clock_() - *batch_opened_ >= options_.max_batch_delay) {
+                sealed = seal();
+            }
+        }
+        send(std::move(sealed));
+    }
+
+    /**
+     * @brief Deliver a response frame read from the target
+     * @return Number of requests completed, or nullopt if the frame is invalid
+     */
+    std::optional<size_t> on_response(std::span<const std::byte> wire) {
+        auto frame = parse_frame(wire);
+        if (!frame.payload_valid()) return std::nullopt;
+        auto entries = ForwardBatchCodec::decode(frame.payload, ForwardBatchCodec::Kind::Response);
+        if (!entries) return std::nullopt;
+
+        std::vector<std::pair<Callback, const ForwardEntry*>> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& entry : *entries) {
+                auto it = in_flight_.find(entry.correlation_id);
+                if (it == in_flight_.end()) continue;   // Late answer to a failed request
+                ready.emplace_back(std::move(it->second), &entry);
+                in_flight_.erase(it);
+            }
+            stats_.responses += ready.size();
+        }
+        for (auto& [callback, entry] : ready) {
+            if (callback) callback(entry->status, entry->body);
+        }
+        return ready.size();
+    }
+
+    /**
+     * @brief Fail every unanswered request (connection to the target dropped)
+     */
+    void fail_in_flight() {
+        std::map<uint64_t, Callback> failed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            failed.swap(in_flight_);
+            stats_.lost += failed.size();
+        }
+        for (auto& [id, callback] : failed) {
+            if (callback) callback(ForwardStatus::ConnectionLost, {});
+        }
+    }
+
+    [[nodiscard]] size_t in_flight() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return in_flight_.size();
+    }
+
+    [[nodiscard]] size_t pending() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return batch_requests_.size();
+    }
+
+    [[nodiscard]] ProxyForwarderStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+};
+
+/**
+ * @brief Response produced by a target for one forwarded request
+ */
+struct ForwardReply {
+    ForwardStatus status = ForwardStatus::Ok;
+    std::vector<std::byte> body;
+};
+
+/**
+ * @brief Target side: serve a request frame and build the response frame
+ * @param handler Serves one request
+ * @return Response frame, or an empty vector if @p wire is not a valid request frame
+ */
+inline std::vector<std::byte> serve_forward_batch(
+    std::span<const std::byte> wire,
+    const std::function<ForwardReply(std::string_view data_id, std::span<const std::byte> body)>& handler) {
+    auto frame = parse_frame(wire);
+    if (!frame.payload_valid()) return {};
+    auto requests = ForwardBatchCodec::decode(frame.payload, ForwardBatchCodec::Kind::Request);
+    if (!requests) return {};
+
+    std::vector<std::byte> batch;
+    ForwardBatchCodec::begin(batch, ForwardBatchCodec::Kind::Response);
+    for (const auto& request : *requests) {
+        auto reply = handler(request.data_id, request.body);
+        ForwardBatchCodec::append(batch, request.correlation_id, reply.status, {}, reply.body);
+    }
+
+    return make_frame(frame.header.segment_id, 0, SegmentCodec::None, batch,
+                      crc32c(batch)).flatten();
+}
+
+} // namespace redcomponent::offloading
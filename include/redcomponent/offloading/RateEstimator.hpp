@@ -0,0 +1,175 @@
+/**
+ * @file RateEstimator.hpp
+ * @brief Transfer Rate Estimation with EWMA and Sliding Window
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Transfer rate estimator updated once per completed segment
+ *
+ * Maintains three views of the rate:
+ * - ewma_rate(): time-weighted exponential moving average. The smoothing
+ *   factor is 1 - exp(-dt / time_constant), so irregular segment spacing
+ *   does not bias the estimate.
+ * - window_rate(): bytes over the last kWindowSize samples held in a fixed
+ *   ring buffer with microsecond timestamps.
+ * - average_rate(): bytes since start() over microsecond elapsed time.
+ *
+ * Not thread-safe; owners serialize access (e.g. under the manager lock).
+ */
+class RateEstimator {
+public:
+    static constexpr size_t kWindowSize = 64;
+
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct Sample {
+        int64_t timestamp_us = 0;
+        size_t bytes = 0;
+    };
+
+    std::array<Sample, kWindowSize> ring_{};
+    size_t head_ = 0;                       // Next write position
+    size_t count_ = 0;                      // Valid samples in ring
+    size_t window_bytes_ = 0;               // Bytes of all samples in ring except oldest
+
+    std::chrono::microseconds time_constant_;
+    double ewma_ = 0.0;
+    bool ewma_valid_ = false;
+    size_t unaccounted_bytes_ = 0;          // Bytes recorded at the same microsecond
+
+    Clock::time_point start_{};
+    int64_t last_us_ = 0;
+    size_t total_bytes_ = 0;
+    bool started_ = false;
+
+    [[nodiscard]] int64_t since_start_us(Clock::time_point now) const {
+        return std::chrono::duration_cast<std::chrono::microseconds>(now - start_).count();
+    }
+
+    [[nodiscard]] const Sample& oldest() const {
+        return ring_[(head_ + kWindowSize - count_) % kWindowSize];
+    }
+
+    void push_sample(int64_t timestamp_us, size_t bytes) {
+        if (count_ == kWindowSize) {
+            // Oldest leaves; the next oldest becomes the window anchor
+            const Sample& next = ring_[(head_ + 1) % kWindowSize];
+            window_bytes_ -= next.bytes;
+        } else {
+            ++count_;
+        }
+        if (count_ > 1) {
+            window_bytes_ += bytes;
+        }
+        ring_[head_] = {timestamp_us, bytes};
+        head_ = (head_ + 1) % kWindowSize;
+    }
+
+public:
+    /**
+     * @brief Construct estimator
+     * @param time_constant EWMA time constant (how quickly old rates decay)
+     */
+    explicit RateEstimator(
+        std::chrono::microseconds time_constant = std::chrono::seconds{2})
+        : time_constant_(time_constant) {}
+
+    /**
+     * @brief Reset and mark the start of a transfer
+     */
+    void start(Clock::time_point now) {
+        *this = RateEstimator{time_constant_};
+        start_ = now;
+        started_ = true;
+        push_sample(0, 0);
+    }
+
+    /**
+     * @brief Record a completed segment
+     * @param bytes Bytes in the segment
+     * @param now Completion timestamp
+     */
+    void record(size_t bytes, Clock::time_point now) {
+        if (!started_) {
+            start(now);
+        }
+        int64_t ts = since_start_us(now);
+        total_bytes_ += bytes;
+
+        int64_t dt = ts - last_us_;
+        if (dt <= 0) {
+            // Same microsecond (or clock skew): fold into the next sample
+            unaccounted_bytes_ += bytes;
+            return;
+        }
+
+        size_t sample_bytes = bytes + unaccounted_bytes_;
+        unaccounted_bytes_ = 0;
+        double instant = static_cast<double>(sample_bytes) * 1e6 / static_cast<double>(dt);
+        if (!ewma_valid_) {
+            ewma_ = instant;
+            ewma_valid_ = true;
+        } else {
+            double alpha = 1.0 - std::exp(
+                -static_cast<double>(dt) / static_cast<double>(time_constant_.count()));
+            ewma_ += alpha * (instant - ewma_);
+        }
+
+        push_sample(ts, sample_bytes);
+        last_us_ = ts;
+    }
+
+    /**
+     * @brief Exponentially smoothed rate in bytes per second
+     */
+    [[nodiscard]] double ewma_rate() const {
+        return ewma_valid_ ? ewma_ : 0.0;
+    }
+
+    /**
+     * @brief Rate over the sliding window in bytes per second
+     */
+    [[nodiscard]] double window_rate() const {
+        if (count_ < 2) return 0.0;
+        int64_t span = last_us_ - oldest().timestamp_us;
+        if (span <= 0) return 0.0;
+        return static_cast<double>(window_bytes_) * 1e6 / static_cast<double>(span);
+    }
+
+    /**
+     * @brief Average rate since start() in bytes per second
+     */
+    [[nodiscard]] double average_rate() const {
+        if (last_us_ <= 0) return 0.0;
+        return static_cast<double>(total_bytes_) * 1e6 / static_cast<double>(last_us_);
+    }
+
+    /**
+     * @brief Total bytes recorded since start()
+     */
+    [[nodiscard]] size_t total_bytes() const {
+        return total_bytes_;
+    }
+
+    /**
+     * @brief Number of samples currently in the sliding window
+     */
+    [[nodiscard]] size_t window_samples() const {
+        return count_;
+    }
+};
+
+} // namespace redcomponent::offloading
@@ -0,0 +1,302 @@
+/**
+ * @file SegmentBufferPool.hpp
+ * @brief Arena-Backed Recycling Pool for Segment Buffers
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "IOffloadManager.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Placement options for a SegmentBufferPool arena
+ */
+struct BufferPoolOptions {
+    int numa_node = -1;                     ///< Preferred NUMA node (-1 = no preference)
+    bool use_hugepages = true;              ///< Back the arena with huge pages if possible
+    bool prefault = true;                   ///< Touch every page at construction
+};
+
+class SegmentBufferPool;
+
+/**
+ * @brief Move-only handle to a pooled slab; returns it to the pool on destruction
+ */
+class SegmentBuffer {
+private:
+    friend class SegmentBufferPool;
+
+    SegmentBufferPool* pool_ = nullptr;
+    std::byte* data_ = nullptr;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+    uint32_t index_ = 0;
+
+    SegmentBuffer(SegmentBufferPool* pool, std::byte* data, size_t capacity, uint32_t index)
+        : pool_(pool), data_(data), capacity_(capacity), index_(index) {}
+
+public:
+    SegmentBuffer() = default;
+    SegmentBuffer(SegmentBuffer&& other) noexcept
+        : pool_(std::exchange(other.pool_, nullptr)), data_(std::exchange(other.data_, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)), size_(std::exchange(other.size_, 0)),
+          index_(other.index_) {}
+    SegmentBuffer& operator=(SegmentBuffer&& other) noexcept {
+        if (this != &other) {
+            release();
+            pool_ = std::exchange(other.pool_, nullptr);
+            data_ = std::exchange(other.data_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+            size_ = std::exchange(other.size_, 0);
+            index_ = other.index_;
+        }
+        return *this;
+    }
+    SegmentBuffer(const SegmentBuffer&) = delete;
+    SegmentBuffer& operator=(const SegmentBuffer&) = delete;
+    ~SegmentBuffer() { release(); }
+
+    [[nodiscard]] explicit operator bool() const { return data_ != nullptr; }
+    [[nodiscard]] std::byte* data() { return data_; }
+    [[nodiscard]] const std::byte* data() const { return data_; }
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+
+    /**
+     * @brief Number of valid bytes (set by the producer of the segment)
+     */
+    [[nodiscard]] size_t size() const { return size_; }
+    void resize(size_t size) { size_ = size <= capacity_ ? size : capacity_; }
+
+    [[nodiscard]] std::span<std::byte> bytes() { return {data_, size_}; }
+    [[nodiscard]] std::span<const std::byte> bytes() const { return {data_, size_}; }
+
+    /**
+     * @brief Return the slab to its pool early
+     */
+    void release();
+};
+
+/**
+ * @brief Fixed pool of equally sized slabs carved from one arena
+ *
+ * The arena is allocated once (huge-page backed and NUMA-bound on Linux
+ * when requested) and optionally pre-faulted, so steady-state offloads
+ * perform no heap allocation per segment and never fragment the host
+ * allocator. Free slabs sit on a Treiber stack whose head carries a
+ * 32-bit tag to defeat ABA; acquire/release are lock-free.
+ */
+class SegmentBufferPool {
+private:
+    static constexpr uint32_t kNil = 0xFFFFFFFFu;
+    static constexpr size_t kPageSize = 4096;
+    static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+    size_t slab_size_ = 0;
+    size_t slab_count_ = 0;
+    size_t arena_bytes_ = 0;
+    std::byte* arena_ = nullptr;
+    bool mapped_ = false;
+    bool hugepages_ = false;
+    bool numa_bound_ = false;
+
+    std::unique_ptr<std::atomic<uint32_t>[]> next_;
+    std::atomic<uint64_t> head_{pack(kNil, 0)};
+    std::atomic<size_t> available_{0};
+
+    static constexpr uint64_t pack(uint32_t index, uint32_t tag) {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+    static constexpr uint32_t index_of(uint64_t head) { return static_cast<uint32_t>(head); }
+    static constexpr uint32_t tag_of(uint64_t head) { return static_cast<uint32_t>(head >> 32); }
+
+    static size_t round_up(size_t value, size_t align) {
+        return (value + align - 1) / align * align;
+    }
+
+    void allocate_arena(const BufferPoolOptions& options) {
+#if defined(__linux__)
+        if (options.use_hugepages) {
+            size_t bytes = round_up(arena_bytes_, kHugePageSize);
+            void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (p != MAP_FAILED) {
+                arena_ = static_cast<std::byte*>(p);
+                arena_bytes_ = bytes;
+                mapped_ = hugepages_ = true;
+            }
+        }
+        if (!arena_) {
+            void* p = ::mmap(nullptr, arena_bytes_, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) throw std::bad_alloc();
+            arena_ = static_cast<std::byte*>(p);
+            mapped_ = true;
+#if defined(MADV_HUGEPAGE)
+            if (options.use_hugepages) {
+                // Transparent huge pages as fallback when none are reserved
+                hugepages_ = ::madvise(arena_, arena_bytes_, MADV_HUGEPAGE) == 0;
+            }
+#endif
+        }
+#if defined(SYS_mbind)
+        if (options.numa_node >= 0 && options.numa_node < 64) {
+            constexpr int kMpolPreferred = 1;
+            unsigned long mask = 1UL << options.numa_node;
+            numa_bound_ = ::syscall(SYS_mbind, arena_, arena_bytes_, kMpolPreferred,
+                                    &mask, sizeof(mask) * 8, 0) == 0;
+        }
+#endif
+#else
+        (void)options;
+        arena_ = static_cast<std::byte*>(
+            ::operator new(arena_bytes_, std::align_val_t{kPageSize}));
+#endif
+        if (options.prefault) {
+            for (size_t off = 0; off < arena_bytes_; off += kPageSize) {
+                arena_[off] = std::byte{0};
+            }
+        }
+    }
+
+    void free_arena() {
+        if (!arena_) return;
+#if defined(__linux__)
+        if (mapped_) {
+            ::munmap(arena_, arena_bytes_);
+            arena_ = nullptr;
+            return;
+        }
+#endif
+        ::operator delete(arena_, std::align_val_t{kPageSize});
+        arena_ = nullptr;
+    }
+
+    void push(uint32_t index) {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            next_[index].store(index_of(head), std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(head, pack(index, tag_of(head) + 1),
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        available_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool pop(uint32_t& index) {
+        uint64_t head = head_.load(std::memory_order_acquire);
+        for (;;) {
+            uint32_t top = index_of(head);
+            if (top == kNil) return false;
+            uint32_t next = next_[top].load(std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(head, pack(next, tag_of(head) + 1),
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire)) {
+                index = top;
+                available_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Construct pool
+     * @param slab_count Number of slabs (max buffers in flight)
+     * @param slab_size Usable bytes per slab (rounded up to the page size)
+     * @param options Arena placement options
+     * @throws std::bad_alloc if the arena cannot be allocated
+     */
+    SegmentBufferPool(size_t slab_count, size_t slab_size,
+                      const BufferPoolOptions& options = {})
+        : slab_size_(round_up(slab_size == 0 ? 1 : slab_size, kPageSize)),
+          slab_count_(slab_count),
+          arena_bytes_(slab_size_ * slab_count),
+          next_(std::make_unique<std::atomic<uint32_t>[]>(slab_count)) {
+        if (slab_count_ == 0 || slab_count_ >= kNil) throw std::bad_alloc();
+        allocate_arena(options);
+        for (size_t i = slab_count_; i-- > 0;) {
+            push(static_cast<uint32_t>(i));
+        }
+    }
+
+    /**
+     * @brief Size a pool for an OffloadConfig
+     *
+     * One slab of segment_size per concurrent transfer, times
+     * @p slabs_per_transfer to cover buffers held by pipeline stages.
+     */
+    [[nodiscard]] static std::unique_ptr<SegmentBufferPool> for_config(
+        const OffloadConfig& config, size_t slabs_per_transfer = 1,
+        const BufferPoolOptions& options = {}) {
+        size_t count = std::max<size_t>(config.max_concurrent_transfers, 1) *
+                       std::max<size_t>(slabs_per_transfer, 1);
+        return std::make_unique<SegmentBufferPool>(count, config.segment_size, options);
+    }
+
+    ~SegmentBufferPool() { free_arena(); }
+
+    SegmentBufferPool(const SegmentBufferPool&) = delete;
+    SegmentBufferPool& operator=(const SegmentBufferPool&) = delete;
+
+    /**
+     * @brief Take a free slab
+     * @return Empty buffer if all slabs are in use (caller applies backpressure)
+     */
+    [[nodiscard]] SegmentBuffer try_acquire() {
+        uint32_t index;
+        if (!pop(index)) return {};
+        return SegmentBuffer{this, arena_ + static_cast<size_t>(index) * slab_size_,
+                             slab_size_, index};
+    }
+
+    [[nodiscard]] size_t slab_size() const { return slab_size_; }
+    [[nodiscard]] size_t capacity() const { return slab_count_; }
+    [[nodiscard]] size_t available() const { return available_.load(std::memory_order_relaxed); }
+    [[nodiscard]] bool uses_hugepages() const { return hugepages_; }
+    [[nodiscard]] bool numa_bound() const { return numa_bound_; }
+
+    /**
+     * @brief Check whether @p p points into this pool's arena
+     */
+    [[nodiscard]] bool owns(const void* p) const {
+        auto* b = static_cast<const std::byte*>(p);
+        return b >= arena_ && b < arena_ + slab_size_ * slab_count_;
+    }
+
+private:
+    friend class SegmentBuffer;
+
+    void recycle(uint32_t index) { push(index); }
+};
+
+inline void SegmentBuffer::release() {
+    if (pool_) {
+        pool_->recycle(index_);
+        pool_ = nullptr;
+        data_ = nullptr;
+        capacity_ = 0;
+        size_ = 0;
+    }
+}
+
+} // namespace redcomponent::offloading
@@ -0,0 +1,241 @@
+/**
+ * @file SegmentFrame.hpp
+ * @brief Versioned Binary Segment Frames with Scatter-Gather Encoding
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "Checksum.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/uio.h>
+#endif
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Payload encoding of a segment frame
+ */
+enum class SegmentCodec : uint8_t {
+    None = 0,           ///< Raw segment bytes
+    Compressed = 1      ///< Output of the pipeline's compress stage
+};
+
+/**
+ * @brief Convert SegmentCodec to string
+ */
+inline std::string to_string(SegmentCodec codec) {
+    switch (codec) {
+        case SegmentCodec::None:       return "None";
+        case SegmentCodec::Compressed: return "Compressed";
+        default:                       return "Unknown";
+    }
+}
+
+inline constexpr uint32_t kSegmentFrameMagic = 0x46534352u;    // "RCSF"
+inline constexpr uint8_t kSegmentFrameVersion = 1;
+inline constexpr size_t kSegmentFrameHeaderSize = 36;         // 0.0034% of a 1MB segment
+
+/**
+ * @brief Decoded frame header
+ *
+ * Wire layout (little-endian, 36 bytes): magic u32, version u8, codec u8,
+ * flags u16, segment_id u64, offset u64, length u32, payload CRC32C u32,
+ * header CRC32C u32 of the preceding 32 bytes. The payload follows.
+ */
+struct SegmentFrameHeader {
+    uint64_t segment_id = 0;
+    uint64_t offset = 0;                    ///< Byte offset of the segment in the offloaded data
+    uint32_t length = 0;                    ///< Payload bytes following the header
+    SegmentCodec codec = SegmentCodec::None;
+    uint16_t flags = 0;                     ///< Reserved; zero in version 1
+    uint32_t checksum = 0;                  ///< CRC32C of the payload
+};
+
+namespace detail {
+
+inline void store_le(std::byte* out, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; ++i) {
+        out[i] = static_cast<std::byte>(value >> (8 * i));
+    }
+}
+
+[[nodiscard]] inline uint64_t load_le(const std::byte* in, size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+} // namespace detail
+
+/**
+ * @brief Serialize a frame header
+ */
+[[nodiscard]] inline std::array<std::byte, kSegmentFrameHeaderSize> encode_frame_header(
+    const SegmentFrameHeader& header) {
+    std::array<std::byte, kSegmentFrameHeaderSize> out{};
+    detail::store_le(&out[0], kSegmentFrameMagic, 4);
+    detail::store_le(&out[4], kSegmentFrameVersion, 1);
+    detail::store_le(&out[5], static_cast<uint8_t>(header.codec), 1);
+    detail::store_le(&out[6], header.flags, 2);
+    detail::store_le(&out[8], header.segment_id, 8);
+    detail::store_le(&out[16], header.offset, 8);
+    detail::store_le(&out[24], header.length, 4);
+    detail::store_le(&out[28], header.checksum, 4);
+    detail::store_le(&out[32], crc32c(std::span<const std::byte>(out).first(32)), 4);
+    return out;
+}
+
+/**
+ * @brief A frame ready to send: encoded header plus a view of the payload
+ *
+ * The payload is never copied; gather() yields the two buffers for a
+ * vectored write straight from the pooled segment buffer.
+ */
+struct OutgoingFrame {
+    std::array<std::byte, kSegmentFrameHeaderSize> header{};
+    std::span<const std::byte> payload;
+
+    [[nodiscard]] std::array<std::span<const std::byte>, 2> gather() const {
+        return {std::span<const std::byte>(header), payload};
+    }
+
+    [[nodiscard]] size_t size() const { return header.size() + payload.size(); }
+
+    /**
+     * @brief Contiguous copy of the frame (for in-process channels)
+     */
+    [[nodiscard]] std::vector<std::byte> flatten() const {
+        std::vector<std::byte> out;
+        out.reserve(size());
+        out.insert(out.end(), header.begin(), header.end());
+        out.insert(out.end(), payload.begin(), payload.end());
+        return out;
+    }
+
+#if defined(__linux__)
+    /**
+     * @brief iovecs for writev()/sendmsg() (valid while this frame and the payload live)
+     */
+    [[nodiscard]] std::array<iovec, 2> to_iovec() const {
+        return {iovec{const_cast<std::byte*>(header.data()), header.size()},
+                iovec{const_cast<std::byte*>(payload.data()), payload.size()}};
+    }
+#endif
+};
+
+/**
+ * @brief Frame a segment
+ * @param checksum CRC32C of @p payload, as computed by the pipeline's checksum stage
+ */
+[[nodiscard]] inline OutgoingFrame make_frame(uint64_t segment_id, uint64_t offset,
+                                              SegmentCodec codec,
+                                              std::span<const std::byte> payload,
+                                              uint32_t checksum) {
+    SegmentFrameHeader header;
+    header.segment_id = segment_id;
+    header.offset = offset;
+    header.length = static_cast<uint32_t>(payload.size());
+    header.codec = codec;
+    header.checksum = checksum;
+    return OutgoingFrame{encode_frame_header(header), payload};
+}
+
+/**
+ * @brief Outcome of parsing a frame from a receive buffer
+ */
+enum class FrameParseStatus {
+    Ok,
+    NeedMoreData,       ///< Buffer ends inside the frame; read more and retry
+    BadMagic,           ///< Not a frame boundary (stream out of sync)
+    UnsupportedVersion,
+    CorruptHeader,      ///< Header CRC mismatch
+    UnknownCodec
+};
+
+/**
+ * @brief Convert FrameParseStatus to string
+ */
+inline std::string to_string(FrameParseStatus status) {
+    switch (status) {
+        case FrameParseStatus::Ok:                 return "Ok";
+        case FrameParseStatus::NeedMoreData:       return "NeedMoreData";
+        case FrameParseStatus::BadMagic:           return "BadMagic";
+        case FrameParseStatus::UnsupportedVersion: return "UnsupportedVersion";
+        case FrameParseStatus::CorruptHeader:      return "CorruptHeader";
+        case FrameParseStatus::UnknownCodec:       return "UnknownCodec";
+        default:                                   return "Unknown";
+    }
+}
+
+/**
+ * @brief A parsed frame; payload points into the receive buffer
+ */
+struct FrameView {
+    FrameParseStatus status = FrameParseStatus::NeedMoreData;
+    SegmentFrameHeader header;
+    std::span<const std::byte> payload;
+    size_t consumed = 0;                    ///< Bytes of the buffer this frame occupies
+    size_t needed = kSegmentFrameHeaderSize; ///< Total bytes required when NeedMoreData
+
+    /**
+     * @brief Whether the payload matches the header checksum
+     */
+    [[nodiscard]] bool payload_valid() const {
+        return status == FrameParseStatus::Ok && crc32c(payload) == header.checksum;
+    }
+};
+
+/**
+ * @brief Parse the frame at the start of @p buffer without copying
+ */
+[[nodiscard]] inline FrameView parse_frame(std::span<const std::byte> buffer) {
+    FrameView view;
+    if (buffer.size() < kSegmentFrameHeaderSize) return view;
+
+    const std::byte* p = buffer.data();
+    if (detail::load_le(p, 4) != kSegmentFrameMagic) {
+        view.status = FrameParseStatus::BadMagic;
+        return view;
+    }
+    if (detail::load_le(p + 4, 1) != kSegmentFrameVersion) {
+        view.status = FrameParseStatus::UnsupportedVersion;
+        return view;
+    }
+    if (crc32c(buffer.first(32)) != detail::load_le(p + 32, 4)) {
+        view.status = FrameParseStatus::CorruptHeader;
+        return view;
+    }
+    auto codec = static_cast<uint8_t>(detail::load_le(p + 5, 1));
+    if (codec > static_cast<uint8_t>(SegmentCodec::Compressed)) {
+        view.status = FrameParseStatus::UnknownCodec;
+        return view;
+    }
+
+    view.header.codec = static_cast<SegmentCodec>(codec);
+    view.header.flags = static_cast<uint16_t>(detail::load_le(p + 6, 2));
+    view.header.segment_id = detail::load_le(p + 8, 8);
+    view.header.offset = detail::load_le(p + 16, 8);
+    view.header.length = static_cast<uint32_t>(detail::load_le(p + 24, 4));
+    view.header.checksum = static_cast<uint32_t>(detail::load_le(p + 28, 4));
+
+    view.needed = kSegmentFrameHeaderSize + view.header.length;
+    if (buffer.size() < view.needed) return view;
+
+    view.status = FrameParseStatus::Ok;
+    view.payload = buffer.subspan(kSegmentFrameHeaderSize, view.header.length);
+    view.consumed = view.needed;
+    return view;
+}
+
+} // namespace redcomponent::offloading
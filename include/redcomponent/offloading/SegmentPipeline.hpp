@@ -0,0 +1,392 @@
+/**
+ * @file SegmentPipeline.hpp
+ * @brief Staged Segment Pipeline (read → compress → checksum → send → ack)
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "Checksum.hpp"
+#include "SegmentBufferPool.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Stage of the segment pipeline
+ */
+enum class PipelineStage : uint8_t {
+    Read,           ///< Read segment from storage into a pooled buffer
+    Compress,       ///< Compress segment in place
+    Checksum,       ///< Compute CRC32C of the (compressed) payload
+    Send,           ///< Hand segment to the transport
+    Ack             ///< Wait for target acknowledgement, recycle buffer
+};
+
+inline constexpr size_t kPipelineStageCount = 5;
+
+/**
+ * @brief Convert PipelineStage to string
+ */
+inline std::string to_string(PipelineStage stage) {
+    switch (stage) {
+        case PipelineStage::Read:     return "Read";
+        case PipelineStage::Compress: return "Compress";
+        case PipelineStage::Checksum: return "Checksum";
+        case PipelineStage::Send:     return "Send";
+        case PipelineStage::Ack:      return "Ack";
+        default:                      return "Unknown";
+    }
+}
+
+/**
+ * @brief A segment travelling through the pipeline
+ */
+struct PipelineSegment {
+    uint64_t segment_id = 0;                ///< Sequence number assigned by the pipeline
+    uint64_t offset = 0;                    ///< Source offset, set by the read handler
+    SegmentBuffer buffer;                   ///< Payload (size() = valid bytes)
+    uint32_t checksum = 0;                  ///< CRC32C of the payload after compression
+    bool compressed = false;                ///< Set by the compress handler
+};
+
+/**
+ * @brief Stage callbacks supplied by the engine
+ *
+ * Each returns false to fail the segment. read() returning false means
+ * the source is exhausted. compress may be empty (pass-through).
+ */
+struct PipelineHandlers {
+    std::function<bool(PipelineSegment&)> read;
+    std::function<bool(PipelineSegment&)> compress;
+    std::function<bool(PipelineSegment&)> send;
+    std::function<bool(PipelineSegment&)> ack;
+};
+
+/**
+ * @brief Throughput and saturation of one stage
+ */
+struct StageStats {
+    PipelineStage stage = PipelineStage::Read;
+    size_t segments = 0;                    ///< Segments processed
+    size_t bytes = 0;                       ///< Payload bytes processed
+    std::chrono::microseconds busy{0};      ///< Time spent inside the handler
+    std::chrono::microseconds starved{0};   ///< Time waiting for input
+    std::chrono::microseconds blocked{0};   ///< Time waiting on downstream (backpressure)
+
+    /**
+     * @brief Throughput while busy (what the stage could sustain alone)
+     */
+    [[nodiscard]] double capacity_bytes_per_second() const {
+        return busy.count() > 0 ? bytes * 1e6 / static_cast<double>(busy.count()) : 0.0;
+    }
+};
+
+/**
+ * @brief Outcome of a pipeline run
+ */
+struct PipelineResult {
+    size_t segments_completed = 0;
+    size_t segments_failed = 0;
+    size_t bytes_completed = 0;
+    std::vector<uint64_t> failed_segment_ids;
+    std::chrono::microseconds elapsed{0};
+    std::array<StageStats, kPipelineStageCount> stages{};
+
+    [[nodiscard]] double bytes_per_second() const {
+        return elapsed.count() > 0 ? bytes_completed * 1e6 / static_cast<double>(elapsed.count())
+                                   : 0.0;
+    }
+
+    /**
+     * @brief Stage with the highest busy time (the resource that limits throughput)
+     */
+    [[nodiscard]] PipelineStage bottleneck() const {
+        size_t worst = 0;
+        for (size_t i = 1; i < stages.size(); ++i) {
+            if (stages[i].busy > stages[worst].busy) worst = i;
+        }
+        return stages[worst].stage;
+    }
+};
+
+/**
+ * @brief Bounded blocking FIFO between two pipeline stages
+ */
+template <typename T>
+class BoundedQueue {
+private:
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<T> items_;
+    size_t capacity_;
+    bool closed_ = false;
+
+public:
+    explicit BoundedQueue(size_t capacity) : capacity_(capacity == 0 ? 1 : capacity) {}
+
+    /**
+     * @brief Push, blocking while full
+     * @return false if the queue was closed
+     */
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] { return closed_ || items_.size() < capacity_; });
+        if (closed_) return false;
+        items_.push_back(std::move(item));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Pop, blocking while empty
+     * @return nullopt once closed and drained
+     */
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+        if (items_.empty()) return std::nullopt;
+        T item = std::move(items_.front());
+        items_.pop_front();
+        not_full_.notify_one();
+        return item;
+    }
+
+    /**
+     * @brief Stop accepting items; pending items can still be popped
+     */
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+};
+
+/**
+ * @brief Multi-stage segment pipeline with per-stage threads
+ *
+ * Every stage runs on its own thread and hands segments downstream
+ * through a BoundedQueue of depth queue_depth, so disk, CPU and network
+ * work overlap. Backpressure comes from two sources: a full queue blocks
+ * the upstream stage, and the read stage cannot start a new segment until
+ * a pooled buffer is recycled by the ack stage.
+ */
+class SegmentPipeline {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct StageCounters {
+        std::atomic<size_t> segments{0};
+        std::atomic<size_t> bytes{0};
+        std::atomic<int64_t> busy_us{0};
+        std::atomic<int64_t> starved_us{0};
+        std::atomic<int64_t> blocked_us{0};
+    };
+
+    SegmentBufferPool& pool_;
+    PipelineHandlers handlers_;
+    size_t queue_depth_;
+
+    std::array<StageCounters, kPipelineStageCount> counters_;
+    std::atomic<bool> cancelled_{false};
+    std::mutex result_mutex_;
+    PipelineResult result_;
+
+    std::mutex buffer_mutex_;
+    std::condition_variable buffer_cv_;
+
+    static int64_t since_us(Clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+    }
+
+    StageCounters& counters(PipelineStage stage) {
+        return counters_[static_cast<size_t>(stage)];
+    }
+
+    void recycle(PipelineSegment& segment) {
+        {
+            std::lock_guard<std::mutex> lock(buffer_mutex_);
+            segment.buffer.release();
+        }
+        buffer_cv_.notify_one();
+    }
+
+    void fail(PipelineSegment& segment) {
+        {
+            std::lock_guard<std::mutex> lock(result_mutex_);
+            result_.segments_failed++;
+            result_.failed_segment_ids.push_back(segment.segment_id);
+        }
+        recycle(segment);
+    }
+
+    SegmentBuffer wait_for_buffer() {
+        std::unique_lock<std::mutex> lock(buffer_mutex_);
+        SegmentBuffer buffer;
+        buffer_cv_.wait(lock, [&] {
+            buffer = pool_.try_acquire();
+            return buffer || cancelled_.load(std::memory_order_relaxed);
+        });
+        return buffer;
+    }
+
+    void run_read(BoundedQueue<PipelineSegment>& out) {
+        auto& c = counters(PipelineStage::Read);
+        for (uint64_t id = 0; !cancelled_.load(std::memory_order_relaxed); ++id) {
+            auto wait_start = Clock::now();
+            PipelineSegment segment;
+            segment.segment_id = id;
+            segment.buffer = wait_for_buffer();
+            c.blocked_us += since_us(wait_start);
+            if (!segment.buffer) break;
+
+            auto start = Clock::now();
+            bool more = handlers_.read(segment);
+            c.busy_us += since_us(start);
+            if (!more) {
+                recycle(segment);
+                break;
+            }
+            c.segments++;
+            c.bytes += segment.buffer.size();
+
+            auto push_start = Clock::now();
+            bool pushed = out.push(std::move(segment));
+            c.blocked_us += since_us(push_start);
+            if (!pushed) break;
+        }
+        out.close();
+    }
+
+    template <typename Work>
+    void run_stage(PipelineStage stage, BoundedQueue<PipelineSegment>& in,
+                   BoundedQueue<PipelineSegment>* out, Work&& work) {
+        auto& c = counters(stage);
+        for (;;) {
+            auto wait_start = Clock::now();
+            auto segment = in.pop();
+            c.starved_us += since_us(wait_start);
+            if (!segment) break;
+
+            auto start = Clock::now();
+            size_t bytes = segment->buffer.size();
+            bool ok = !cancelled_.load(std::memory_order_relaxed) && work(*segment);
+            c.busy_us += since_us(start);
+            if (!ok) {
+                fail(*segment);
+                continue;
+            }
+            c.segments++;
+            c.bytes += bytes;
+
+            if (out) {
+                auto push_start = Clock::now();
+                bool pushed = out->push(std::move(*segment));
+                c.blocked_us += since_us(push_start);
+                if (!pushed) fail(*segment);
+            } else {
+                std::lock_guard<std::mutex> lock(result_mutex_);
+                result_.segments_completed++;
+                result_.bytes_completed += bytes;
+                recycle(*segment);
+            }
+        }
+        if (out) out->close();
+    }
+
+public:
+    /**
+     * @brief Construct pipeline
+     * @param pool Buffer pool (its capacity bounds segments in flight)
+     * @param handlers Stage callbacks
+     * @param queue_depth Capacity of each inter-stage queue
+     */
+    SegmentPipeline(SegmentBufferPool& pool, PipelineHandlers handlers, size_t queue_depth = 2)
+        : pool_(pool), handlers_(std::move(handlers)), queue_depth_(queue_depth) {}
+
+    /**
+     * @brief Run until the source is exhausted or cancel() is called
+     */
+    PipelineResult run() {
+        auto start = Clock::now();
+        BoundedQueue<PipelineSegment> to_compress(queue_depth_);
+        BoundedQueue<PipelineSegment> to_checksum(queue_depth_);
+        BoundedQueue<PipelineSegment> to_send(queue_depth_);
+        BoundedQueue<PipelineSegment> to_ack(queue_depth_);
+
+        std::vector<std::thread> threads;
+        threads.emplace_back([&] { run_read(to_compress); });
+        threads.emplace_back([&] {
+            run_stage(PipelineStage::Compress, to_compress, &to_checksum,
+                      [this](PipelineSegment& s) {
+                          return !handlers_.compress || handlers_.compress(s);
+                      });
+        });
+        threads.emplace_back([&] {
+            run_stage(PipelineStage::Checksum, to_checksum, &to_send,
+                      [](PipelineSegment& s) {
+                          s.checksum = crc32c(s.buffer.bytes());
+                          return true;
+                      });
+        });
+        threads.emplace_back([&] {
+            run_stage(PipelineStage::Send, to_send, &to_ack,
+                      [this](PipelineSegment& s) { return handlers_.send(s); });
+        });
+        threads.emplace_back([&] {
+            run_stage(PipelineStage::Ack, to_ack, nullptr,
+                      [this](PipelineSegment& s) { return handlers_.ack(s); });
+        });
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        std::lock_guard<std::mutex> lock(result_mutex_);
+        result_.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - start);
+        result_.stages = stats();
+        return result_;
+    }
+
+    /**
+     * @brief Stop reading new segments; in-flight segments are failed
+     */
+    void cancel() {
+        cancelled_.store(true, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(buffer_mutex_);
+        buffer_cv_.notify_all();
+    }
+
+    /**
+     * @brief Live per-stage statistics (safe to call while run() is active)
+     */
+    [[nodiscard]] std::array<StageStats, kPipelineStageCount> stats() const {
+        std::array<StageStats, kPipelineStageCount> out{};
+        for (size_t i = 0; i < kPipelineStageCount; ++i) {
+            const auto& c = counters_[i];
+            out[i].stage = static_cast<PipelineStage>(i);
+            out[i].segments = c.segments.load();
+            out[i].bytes = c.bytes.load();
+            out[i].busy = std::chrono::microseconds{c.busy_us.load()};
+            out[i].starved = std::chrono::microseconds{c.starved_us.load()};
+            out[i].blocked = std::chrono::microseconds{c.blocked_us.load()};
+        }
+        return out;
+    }
+};
+
+} // namespace redcomponent::offloading
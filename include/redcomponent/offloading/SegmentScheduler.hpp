@@ -0,0 +1,234 @@
+/**
+ * @file SegmentScheduler.hpp
+ * @brief Priority Classes and Weighted-Fair Scheduling of Offload Segments
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "OffloadPolicy.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Priority class of an offload job
+ */
+enum class OffloadPriority : uint8_t {
+    Emergency,      ///< Storage threshold breach; must drain within the SLA
+    High,           ///< Memory pressure relief
+    Normal,         ///< Operator-requested offloads
+    Background      ///< Rebalancing and housekeeping
+};
+
+inline constexpr size_t kOffloadPriorityCount = 4;
+
+/**
+ * @brief Convert OffloadPriority to string
+ */
+inline std::string to_string(OffloadPriority priority) {
+    switch (priority) {
+        case OffloadPriority::Emergency:  return "Emergency";
+        case OffloadPriority::High:       return "High";
+        case OffloadPriority::Normal:     return "Normal";
+        case OffloadPriority::Background: return "Background";
+        default:                          return "Unknown";
+    }
+}
+
+/**
+ * @brief Priority class of an automatic offload triggered by @p sample
+ */
+[[nodiscard]] inline OffloadPriority priority_for(const ResourceSample& sample,
+                                                  const OffloadConfig& config) {
+    if (sample.storage_usage_percent >= config.storage_threshold_percent) {
+        return OffloadPriority::Emergency;
+    }
+    if (sample.memory_usage_percent >= config.memory_threshold_percent) {
+        return OffloadPriority::High;
+    }
+    return OffloadPriority::Background;
+}
+
+/**
+ * @brief Relative bandwidth share of each priority class
+ *
+ * With both backlogged, a job of class A receives weight(A) / weight(B)
+ * times the bytes of a job of class B; no class with a non-zero weight
+ * is starved.
+ */
+struct PriorityWeights {
+    std::array<double, kOffloadPriorityCount> weights{64.0, 16.0, 4.0, 1.0};
+
+    [[nodiscard]] double of(OffloadPriority priority) const {
+        double w = weights[static_cast<size_t>(priority)];
+        return w > 0.0 ? w : 1e-9;
+    }
+};
+
+/**
+ * @brief A segment handed out by the scheduler
+ */
+struct ScheduledSegment {
+    uint64_t job_id = 0;
+    size_t segment_index = 0;
+    size_t bytes = 0;
+    OffloadPriority priority = OffloadPriority::Normal;
+};
+
+/**
+ * @brief Weighted-fair scheduler over segments of concurrent offload jobs
+ *
+ * Start-time fair queuing: each job carries a virtual finish tag that
+ * advances by bytes / weight per scheduled segment, and next() serves
+ * the job with the smallest tag. A job joining (or re-joining after
+ * idling) starts at the current virtual time, so it neither waits behind
+ * earlier jobs nor claims credit for time it was idle. An emergency job
+ * therefore gets the next segment slot and ~64/65 of the bandwidth
+ * against background work, which still advances. Thread-safe.
+ */
+class SegmentScheduler {
+private:
+    struct Job {
+        OffloadPriority priority = OffloadPriority::Normal;
+        size_t segment_bytes = 0;
+        size_t next_segment = 0;
+        size_t segments_total = 0;
+        std::deque<size_t> retries;         // Segments requeued after failure
+        double finish_tag = 0.0;
+        size_t bytes_scheduled = 0;
+
+        [[nodiscard]] bool backlogged() const {
+            return !retries.empty() || next_segment < segments_total;
+        }
+    };
+
+    mutable std::mutex mutex_;
+    PriorityWeights weights_;
+    std::map<uint64_t, Job> jobs_;
+    uint64_t next_job_id_ = 1;
+    double virtual_time_ = 0.0;
+
+    void activate(Job& job) {
+        job.finish_tag = std::max(job.finish_tag, virtual_time_);
+    }
+
+public:
+    explicit SegmentScheduler(const PriorityWeights& weights = {}) : weights_(weights) {}
+
+    /**
+     * @brief Register a job of @p segments segments
+     * @return Job id
+     */
+    uint64_t add_job(OffloadPriority priority, size_t segments, size_t segment_bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Job job;
+        job.priority = priority;
+        job.segments_total = segments;
+        job.segment_bytes = segment_bytes;
+        job.finish_tag = virtual_time_;
+        uint64_t id = next_job_id_++;
+        jobs_.emplace(id, std::move(job));
+        return id;
+    }
+
+    /**
+     * @brief Dequeue the next segment to transfer
+     * @return nullopt when no job has pending segments
+     */
+    [[nodiscard]] std::optional<ScheduledSegment> next() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint64_t best_id = 0;
+        Job* best = nullptr;
+        for (auto& [id, job] : jobs_) {
+            if (!job.backlogged()) continue;
+            if (!best || job.finish_tag < best->finish_tag) {
+                best = &job;
+                best_id = id;
+            }
+        }
+        if (!best) return std::nullopt;
+
+        ScheduledSegment segment;
+        segment.job_id = best_id;
+        segment.bytes = best->segment_bytes;
+        segment.priority = best->priority;
+        if (!best->retries.empty()) {
+            segment.segment_index = best->retries.front();
+            best->retries.pop_front();
+        } else {
+            segment.segment_index = best->next_segment++;
+        }
+
+        virtual_time_ = best->finish_tag;
+        best->finish_tag += static_cast<double>(segment.bytes) / weights_.of(best->priority);
+        best->bytes_scheduled += segment.bytes;
+        return segment;
+    }
+
+    /**
+     * @brief Put a failed segment back; it is served before the job's new segments
+     */
+    void requeue(const ScheduledSegment& segment) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = jobs_.find(segment.job_id);
+        if (it == jobs_.end()) return;
+        if (!it->second.backlogged()) activate(it->second);
+        it->second.retries.push_back(segment.segment_index);
+    }
+
+    /**
+     * @brief Change a job's class (e.g. escalate a drain to Emergency)
+     */
+    bool set_priority(uint64_t job_id, OffloadPriority priority) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = jobs_.find(job_id);
+        if (it == jobs_.end()) return false;
+        bool promoted = weights_.of(priority) > weights_.of(it->second.priority);
+        it->second.priority = priority;
+        if (promoted) {
+            // Served at the next slot instead of after its old, slower tag
+            it->second.finish_tag = std::min(it->second.finish_tag, virtual_time_);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Remove a job and its pending segments
+     */
+    bool remove_job(uint64_t job_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return jobs_.erase(job_id) > 0;
+    }
+
+    [[nodiscard]] size_t pending_segments(uint64_t job_id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = jobs_.find(job_id);
+        if (it == jobs_.end()) return 0;
+        return it->second.retries.size() + it->second.segments_total - it->second.next_segment;
+    }
+
+    [[nodiscard]] size_t bytes_scheduled(uint64_t job_id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = jobs_.find(job_id);
+        return it == jobs_.end() ? 0 : it->second.bytes_scheduled;
+    }
+
+    [[nodiscard]] bool empty() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& [id, job] : jobs_) {
+            if (job.backlogged()) return false;
+        }
+        return true;
+    }
+};
+
+} // namespace redcomponent::offloading
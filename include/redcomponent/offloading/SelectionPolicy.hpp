@@ -0,0 +1,88 @@
+/**
+ * @file SelectionPolicy.hpp
+ * @brief Power-of-d-Choices Randomized Target Selection
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Power-of-d-choices selection over an indexed candidate list
+ *
+ * Samples d distinct candidates (Floyd's algorithm, O(d) regardless of
+ * cluster size) and returns the best eligible one. Concurrent callers
+ * with independent RNG state sample different subsets, so they spread
+ * over the good nodes instead of all converging on the single best one,
+ * while the max-of-d choice keeps poor nodes rarely chosen.
+ */
+class PowerOfChoices {
+public:
+    static constexpr size_t kMaxRounds = 3;     // Resample rounds before scanning everything
+
+    /**
+     * @brief Pick a candidate
+     * @param count Number of candidates
+     * @param choices Candidates sampled per round (d)
+     * @param rng Caller-owned generator
+     * @param eligible Predicate on a candidate index
+     * @param better Strict ordering: better(a, b) if a is preferable to b
+     * @return Index of the chosen candidate, or nullopt if none is eligible
+     */
+    template <typename Eligible, typename Better>
+    [[nodiscard]] static std::optional<size_t> select(size_t count, size_t choices,
+                                                      std::mt19937_64& rng,
+                                                      Eligible&& eligible, Better&& better) {
+        if (count == 0) return std::nullopt;
+
+        auto consider = [&](std::optional<size_t>& best, size_t i) {
+            if (eligible(i) && (!best || better(i, *best))) best = i;
+        };
+
+        std::optional<size_t> best;
+        if (choices > 0 && choices < count) {
+            for (size_t round = 0; round < kMaxRounds && !best; ++round) {
+                for (size_t i : sample(count, choices, rng)) {
+                    consider(best, i);
+                }
+            }
+            if (best) return best;
+        }
+
+        // Few eligible nodes (or d >= n): fall back to a full scan
+        for (size_t i = 0; i < count; ++i) {
+            consider(best, i);
+        }
+        return best;
+    }
+
+    /**
+     * @brief @p k distinct indices from [0, n) (Floyd's algorithm)
+     */
+    [[nodiscard]] static std::vector<size_t> sample(size_t n, size_t k, std::mt19937_64& rng) {
+        std::vector<size_t> picked;
+        picked.reserve(k);
+        for (size_t j = n - k; j < n; ++j) {
+            size_t t = std::uniform_int_distribution<size_t>(0, j)(rng);
+            bool seen = false;
+            for (size_t p : picked) {
+                if (p == t) {
+                    seen = true;
+                    break;
+                }
+            }
+            picked.push_back(seen ? j : t);
+        }
+        return picked;
+    }
+};
+
+} // namespace redcomponent::offloading
@@ -0,0 +1,141 @@
+/**
+ * @file StripePlanner.hpp
+ * @brief Multi-Target Striping of a Single Offload
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "IOffloadManager.hpp"
+#include <string>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Share of a striped offload assigned to one target node
+ */
+struct StripeTarget {
+    std::string node_id;                    ///< Target node identifier
+    double spare_bandwidth = 0.0;           ///< Spare bandwidth used as weight (bytes/s)
+    size_t segment_count = 0;               ///< Segments assigned to this node
+    size_t bytes = 0;                       ///< Bytes assigned to this node
+};
+
+/**
+ * @brief Segment-to-node assignment of a striped offload
+ */
+struct StripePlan {
+    std::vector<StripeTarget> targets;      ///< Participating nodes
+    std::vector<size_t> segment_targets;    ///< Index into targets for each segment
+    size_t unassigned_segments = 0;         ///< Segments no node had storage for
+
+    /**
+     * @brief Check if the plan assigns every segment
+     */
+    [[nodiscard]] bool complete() const {
+        return !segment_targets.empty() && unassigned_segments == 0;
+    }
+
+    /**
+     * @brief Get the node a segment is striped to
+     */
+    [[nodiscard]] const std::string& node_for_segment(size_t segment) const {
+        return targets.at(segment_targets.at(segment)).node_id;
+    }
+
+    /**
+     * @brief Expected drain time when all stripes run in parallel
+     */
+    [[nodiscard]] double expected_seconds() const {
+        double worst = 0.0;
+        for (const auto& t : targets) {
+            if (t.spare_bandwidth > 0.0) {
+                worst = std::max(worst, static_cast<double>(t.bytes) / t.spare_bandwidth);
+            }
+        }
+        return worst;
+    }
+};
+
+/**
+ * @brief Stripes segments across nodes in proportion to spare bandwidth
+ *
+ * Uses smooth weighted round-robin so consecutive segments interleave
+ * across targets instead of arriving in per-node runs. A node is skipped
+ * once the next segment would exceed its available_storage_bytes, so the
+ * storage cap shifts load onto the remaining nodes.
+ */
+class StripePlanner {
+public:
+    /**
+     * @brief Build a stripe plan
+     * @param nodes Candidate nodes (order is the tie-break order)
+     * @param spare_bandwidth Spare bandwidth per node, same order as @p nodes
+     * @param total_bytes Bytes to offload
+     * @param segment_size Segment size in bytes
+     */
+    [[nodiscard]] static StripePlan plan(
+        const std::vector<TargetNode>& nodes,
+        const std::vector<double>& spare_bandwidth,
+        size_t total_bytes,
+        size_t segment_size) {
+        StripePlan result;
+        if (nodes.empty() || total_bytes == 0 || segment_size == 0 ||
+            spare_bandwidth.size() != nodes.size()) {
+            return result;
+        }
+
+        double total_weight = 0.0;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            StripeTarget target;
+            target.node_id = nodes[i].node_id;
+            target.spare_bandwidth = std::max(spare_bandwidth[i], 0.0);
+            total_weight += target.spare_bandwidth;
+            result.targets.push_back(std::move(target));
+        }
+        if (total_weight <= 0.0) {
+            return result;
+        }
+
+        size_t segments = (total_bytes + segment_size - 1) / segment_size;
+        std::vector<double> current(nodes.size(), 0.0);
+        result.segment_targets.reserve(segments);
+
+        for (size_t s = 0; s < segments; ++s) {
+            size_t length = std::min(segment_size, total_bytes - s * segment_size);
+
+            size_t best = std::numeric_limits<size_t>::max();
+            double active_weight = 0.0;
+            for (size_t i = 0; i < nodes.size(); ++i) {
+                auto& t = result.targets[i];
+                if (t.spare_bandwidth <= 0.0 ||
+                    t.bytes + length > nodes[i].available_storage_bytes) {
+                    continue;
+                }
+                current[i] += t.spare_bandwidth;
+                active_weight += t.spare_bandwidth;
+                if (best == std::numeric_limits<size_t>::max() || current[i] > current[best]) {
+                    best = i;
+                }
+            }
+
+            if (best == std::numeric_limits<size_t>::max()) {
+                result.unassigned_segments = segments - s;
+                break;
+            }
+
+            current[best] -= active_weight;
+            result.targets[best].segment_count++;
+            result.targets[best].bytes += length;
+            result.segment_targets.push_back(best);
+        }
+
+        return result;
+    }
+};
+
+} // namespace redcomponent::offloading
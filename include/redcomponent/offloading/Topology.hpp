@@ -0,0 +1,194 @@
+/**
+ * @file Topology.hpp
+ * @brief Cluster Topology Model for Locality-Aware Target Selection
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "IOffloadManager.hpp"
+#include <map>
+#include <string>
+#include <chrono>
+#include <utility>
+#include <algorithm>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Locality tier between two nodes, ordered from closest to farthest
+ */
+enum class Locality {
+    SameZone,       ///< Same cluster and same rack/zone label
+    SameCluster,    ///< Same cluster, different or unknown zone
+    SameRegion,     ///< Same region, different cluster
+    CrossRegion     ///< Different regions
+};
+
+/**
+ * @brief Convert Locality to string
+ */
+inline std::string to_string(Locality locality) {
+    switch (locality) {
+        case Locality::SameZone:    return "SameZone";
+        case Locality::SameCluster: return "SameCluster";
+        case Locality::SameRegion:  return "SameRegion";
+        case Locality::CrossRegion: return "CrossRegion";
+        default:                    return "Unknown";
+    }
+}
+
+/**
+ * @brief Position of a node in the cluster topology
+ */
+struct NodeLocation {
+    std::string region;                     ///< Geographic region
+    std::string cluster_id;                 ///< Cluster identifier
+    std::string zone;                       ///< Rack/zone label (empty if unknown)
+
+    /**
+     * @brief Extract the location of a target node
+     */
+    [[nodiscard]] static NodeLocation of(const TargetNode& node) {
+        return NodeLocation{node.region, node.cluster_id, node.zone};
+    }
+};
+
+/**
+ * @brief Measured or assumed characteristics of a network link
+ */
+struct LinkMetrics {
+    std::chrono::microseconds latency{0};   ///< Round-trip latency
+    double bandwidth_bytes_per_second = 0.0; ///< Sustained bandwidth
+
+    /**
+     * @brief Time to move @p bytes using @p round_trips request/ack exchanges
+     */
+    [[nodiscard]] std::chrono::microseconds transfer_time(
+        size_t bytes, size_t round_trips) const {
+        double seconds = bandwidth_bytes_per_second > 0.0
+            ? static_cast<double>(bytes) / bandwidth_bytes_per_second
+            : 0.0;
+        return latency * static_cast<int64_t>(round_trips) +
+               std::chrono::microseconds{static_cast<int64_t>(seconds * 1e6)};
+    }
+};
+
+/**
+ * @brief Topology model with per-tier defaults and measured link overrides
+ *
+ * Link lookup precedence for a target node:
+ * 1. A per-node measurement (set_node_link)
+ * 2. A measured inter-region link (set_region_link), cross-region only
+ * 3. The default for the locality tier (set_tier_defaults)
+ */
+class TopologyModel {
+private:
+    std::map<Locality, LinkMetrics> tier_defaults_;
+    std::map<std::pair<std::string, std::string>, LinkMetrics> region_links_;
+    std::map<std::string, LinkMetrics> node_links_;
+
+    static std::pair<std::string, std::string> region_key(
+        const std::string& a, const std::string& b) {
+        return a < b ? std::make_pair(a, b) : std::make_pair(b, a);
+    }
+
+public:
+    TopologyModel() {
+        using std::chrono::microseconds;
+        // Defaults: 10 Gbit/s in-rack down to ~1 Gbit/s across regions
+        tier_defaults_[Locality::SameZone]    = {microseconds{100},   1.25e9};
+        tier_defaults_[Locality::SameCluster] = {microseconds{500},   5.0e8};
+        tier_defaults_[Locality::SameRegion]  = {microseconds{2000},  2.5e8};
+        tier_defaults_[Locality::CrossRegion] = {microseconds{50000}, 1.25e8};
+    }
+
+    /**
+     * @brief Classify the locality between two locations
+     */
+    [[nodiscard]] static Locality locality(const NodeLocation& a, const NodeLocation& b) {
+        if (a.region != b.region) return Locality::CrossRegion;
+        if (a.cluster_id != b.cluster_id) return Locality::SameRegion;
+        if (!a.zone.empty() && a.zone == b.zone) return Locality::SameZone;
+        return Locality::SameCluster;
+    }
+
+    /**
+     * @brief Override the default link metrics of a locality tier
+     */
+    void set_tier_defaults(Locality tier, const LinkMetrics& metrics) {
+        tier_defaults_[tier] = metrics;
+    }
+
+    /**
+     * @brief Record measured link metrics between two regions (symmetric)
+     */
+    void set_region_link(const std::string& region_a, const std::string& region_b,
+                         const LinkMetrics& metrics) {
+        region_links_[region_key(region_a, region_b)] = metrics;
+    }
+
+    /**
+     * @brief Record measured link metrics from the local node to a target node
+     */
+    void set_node_link(const std::string& node_id, const LinkMetrics& metrics) {
+        node_links_[node_id] = metrics;
+    }
+
+    /**
+     * @brief Forget a per-node measurement
+     */
+    void clear_node_link(const std::string& node_id) {
+        node_links_.erase(node_id);
+    }
+
+    /**
+     * @brief Resolve the link from @p local to @p node
+     */
+    [[nodiscard]] LinkMetrics link_to(const NodeLocation& local, const TargetNode& node) const {
+        if (auto it = node_links_.find(node.node_id); it != node_links_.end()) {
+            return it->second;
+        }
+        Locality tier = locality(local, NodeLocation::of(node));
+        if (tier == Locality::CrossRegion) {
+            auto it = region_links_.find(region_key(local.region, node.region));
+            if (it != region_links_.end()) {
+                return it->second;
+            }
+        }
+        return tier_defaults_.at(tier);
+    }
+
+    /**
+     * @brief Bandwidth to @p node left after its current network utilization
+     *
+     * Utilization is floored at 5% headroom so a saturated node still ranks.
+     */
+    [[nodiscard]] double spare_bandwidth(const NodeLocation& local, const TargetNode& node) const {
+        double headroom = std::clamp(
+            1.0 - node.network_utilization_percent / 100.0, 0.05, 1.0);
+        return link_to(local, node).bandwidth_bytes_per_second * headroom;
+    }
+
+    /**
+     * @brief Expected time to offload @p bytes from @p local to @p node
+     *
+     * Uses the spare bandwidth and charges one round trip per wave of
+     * max_concurrent_transfers segments.
+     */
+    [[nodiscard]] std::chrono::microseconds expected_transfer_time(
+        const NodeLocation& local, const TargetNode& node,
+        size_t bytes, const OffloadConfig& config) const {
+        LinkMetrics link = link_to(local, node);
+        link.bandwidth_bytes_per_second = spare_bandwidth(local, node);
+
+        size_t segment = std::max<size_t>(config.segment_size, 1);
+        size_t waves = std::max<size_t>(config.max_concurrent_transfers, 1);
+        size_t segments = (bytes + segment - 1) / segment;
+        size_t round_trips = (segments + waves - 1) / waves;
+        return link.transfer_time(bytes, round_trips);
+    }
+};
+
+} // namespace redcomponent::offloading
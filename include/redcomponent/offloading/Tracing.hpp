@@ -0,0 +1,240 @@
+/**
+ * @file Tracing.hpp
+ * @brief Lightweight Offload Lifecycle Tracing (Chrome Trace JSON)
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Traced phase of an offload
+ */
+enum class SpanKind : uint8_t {
+    Preparing,          ///< Offload preparation
+    Transferring,       ///< Whole transfer phase
+    SegmentRead,        ///< Reading a segment from storage
+    SegmentCompress,    ///< Compressing a segment
+    SegmentSend,        ///< Sending a segment until acknowledged
+    SegmentVerify,      ///< Verifying a segment on the target
+    Completing          ///< Offload finalization
+};
+
+/**
+ * @brief Convert SpanKind to string
+ */
+inline std::string to_string(SpanKind kind) {
+    switch (kind) {
+        case SpanKind::Preparing:       return "Preparing";
+        case SpanKind::Transferring:    return "Transferring";
+        case SpanKind::SegmentRead:     return "SegmentRead";
+        case SpanKind::SegmentCompress: return "SegmentCompress";
+        case SpanKind::SegmentSend:     return "SegmentSend";
+        case SpanKind::SegmentVerify:   return "SegmentVerify";
+        case SpanKind::Completing:      return "Completing";
+        default:                        return "Unknown";
+    }
+}
+
+/**
+ * @brief One completed span
+ */
+struct TraceEvent {
+    uint64_t start_ns = 0;                  ///< Start, relative to tracer epoch
+    uint64_t duration_ns = 0;               ///< Span duration
+    uint64_t segment_id = 0;                ///< Segment index (segment spans only)
+    uint32_t thread_index = 0;              ///< Tracer-assigned thread index
+    SpanKind kind = SpanKind::Preparing;
+};
+
+/**
+ * @brief Single-producer ring of trace events that overwrites the oldest
+ *
+ * The owning thread writes without locks or allocation. A reader copies
+ * the live range and then drops any entries the writer may have lapped
+ * while copying, so collected events are never torn.
+ */
+class TraceRing {
+public:
+    static constexpr size_t kCapacity = 4096;   // Power of two
+
+private:
+    std::array<TraceEvent, kCapacity> events_{};
+    std::atomic<uint64_t> head_{0};
+
+public:
+    void push(const TraceEvent& event) {
+        uint64_t idx = head_.load(std::memory_order_relaxed);
+        events_[idx & (kCapacity - 1)] = event;
+        head_.store(idx + 1, std::memory_order_release);
+    }
+
+    void collect(std::vector<TraceEvent>& out) const {
+        uint64_t end = head_.load(std::memory_order_acquire);
+        uint64_t begin = end > kCapacity ? end - kCapacity : 0;
+        std::vector<TraceEvent> copy;
+        copy.reserve(static_cast<size_t>(end - begin));
+        for (uint64_t i = begin; i < end; ++i) {
+            copy.push_back(events_[i & (kCapacity - 1)]);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t after = head_.load(std::memory_order_relaxed);
+        uint64_t safe_begin = after > kCapacity ? after - kCapacity : 0;
+        size_t skip = safe_begin > begin ? static_cast<size_t>(safe_begin - begin) : 0;
+        if (skip < copy.size()) {
+            out.insert(out.end(), copy.begin() + static_cast<std::ptrdiff_t>(skip), copy.end());
+        }
+    }
+};
+
+/**
+ * @brief Collects spans from all threads into per-thread rings
+ *
+ * record() is lock-free after a thread's first event: each thread caches
+ * its ring for the tracer it last used. Disabled tracers cost one relaxed
+ * load per span.
+ */
+class Tracer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct ThreadCache {
+        uint64_t tracer_id = 0;
+        TraceRing* ring = nullptr;
+        uint32_t thread_index = 0;
+    };
+
+    static uint64_t next_id() {
+        static std::atomic<uint64_t> counter{0};
+        return ++counter;
+    }
+
+    const uint64_t id_ = next_id();
+    const Clock::time_point epoch_ = Clock::now();
+    std::atomic<bool> enabled_{false};
+    mutable std::mutex mutex_;
+    std::map<std::thread::id, std::pair<uint32_t, std::unique_ptr<TraceRing>>> rings_;
+
+    ThreadCache& thread_cache() {
+        thread_local ThreadCache cache;
+        if (cache.tracer_id != id_) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto& entry = rings_[std::this_thread::get_id()];
+            if (!entry.second) {
+                entry.first = static_cast<uint32_t>(rings_.size());
+                entry.second = std::make_unique<TraceRing>();
+            }
+            cache = {id_, entry.second.get(), entry.first};
+        }
+        return cache;
+    }
+
+    [[nodiscard]] uint64_t since_epoch_ns(Clock::time_point t) const {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t - epoch_).count();
+        return ns > 0 ? static_cast<uint64_t>(ns) : 0;
+    }
+
+public:
+    Tracer() = default;
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    void set_enabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    [[nodiscard]] bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Record a completed span
+     */
+    void record(SpanKind kind, Clock::time_point start, Clock::time_point end,
+                uint64_t segment_id = 0) {
+        if (!enabled()) return;
+        ThreadCache& cache = thread_cache();
+        TraceEvent event;
+        event.start_ns = since_epoch_ns(start);
+        event.duration_ns = end > start
+            ? static_cast<uint64_t>(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+            : 0;
+        event.segment_id = segment_id;
+        event.thread_index = cache.thread_index;
+        event.kind = kind;
+        cache.ring->push(event);
+    }
+
+    /**
+     * @brief Collect all buffered events from all threads
+     */
+    [[nodiscard]] std::vector<TraceEvent> collect() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<TraceEvent> events;
+        for (const auto& [thread, entry] : rings_) {
+            entry.second->collect(events);
+        }
+        return events;
+    }
+
+    /**
+     * @brief Dump buffered events as Chrome trace JSON (chrome://tracing, Perfetto)
+     */
+    [[nodiscard]] std::string dump_chrome_trace_json() const {
+        auto events = collect();
+        std::string out = "{\"traceEvents\":[";
+        for (size_t i = 0; i < events.size(); ++i) {
+            const auto& e = events[i];
+            if (i > 0) out += ',';
+            out += "{\"name\":\"" + to_string(e.kind) + "\",\"cat\":\"offload\",\"ph\":\"X\"";
+            out += ",\"ts\":" + std::to_string(e.start_ns / 1000) + '.' +
+                   std::to_string(1000 + e.start_ns % 1000).substr(1);
+            out += ",\"dur\":" + std::to_string(e.duration_ns / 1000) + '.' +
+                   std::to_string(1000 + e.duration_ns % 1000).substr(1);
+            out += ",\"pid\":1,\"tid\":" + std::to_string(e.thread_index);
+            if (e.kind >= SpanKind::SegmentRead && e.kind <= SpanKind::SegmentVerify) {
+                out += ",\"args\":{\"segment\":" + std::to_string(e.segment_id) + '}';
+            }
+            out += '}';
+        }
+        out += "],\"displayTimeUnit\":\"ms\"}";
+        return out;
+    }
+};
+
+/**
+ * @brief RAII span that records itself on destruction
+ */
+class ScopedSpan {
+private:
+    Tracer& tracer_;
+    SpanKind kind_;
+    uint64_t segment_id_;
+    Tracer::Clock::time_point start_;
+
+public:
+    ScopedSpan(Tracer& tracer, SpanKind kind, uint64_t segment_id = 0)
+        : tracer_(tracer), kind_(kind), segment_id_(segment_id),
+          start_(tracer.enabled() ? Tracer::Clock::now() : Tracer::Clock::time_point{}) {}
+
+    ~ScopedSpan() {
+        if (tracer_.enabled() && start_ != Tracer::Clock::time_point{}) {
+            tracer_.record(kind_, start_, Tracer::Clock::now(), segment_id_);
+        }
+    }
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    ScopedSpan& operator=(const ScopedSpan&) = delete;
+};
+
+} // namespace redcomponent::offloading
@@ -0,0 +1,223 @@
+/**
+ * @file TrafficShifter.hpp
+ * @brief PID-Controlled Gradual Shifting Between Endpoint and Proxy Modes
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "OffloadPolicy.hpp"
+#include "Checksum.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief How a request is handled
+ */
+enum class ProtocolMode {
+    Endpoint,       ///< Process locally
+    Proxy           ///< Forward to the node holding (or receiving) the data
+};
+
+/**
+ * @brief Convert ProtocolMode to string
+ */
+inline std::string to_string(ProtocolMode mode) {
+    switch (mode) {
+        case ProtocolMode::Endpoint: return "Endpoint";
+        case ProtocolMode::Proxy:    return "Proxy";
+        default:                     return "Unknown";
+    }
+}
+
+/**
+ * @brief Traffic shifter tuning
+ *
+ * The error is the largest overshoot of CPU or memory above its
+ * setpoint, in percentage points; the output is the proxied fraction.
+ * Defaults settle a 20-point overload within ~15 updates at 1 s without
+ * overshooting by more than half a point.
+ */
+struct TrafficShifterOptions {
+    double target_cpu_percent = 75.0;       ///< CPU setpoint
+    double target_memory_percent = 80.0;    ///< Memory setpoint
+    double kp = 0.005;                      ///< Fraction per point of error
+    double ki = 0.004;                      ///< Fraction per point-second of accumulated error
+    double kd = 0.0;                        ///< Fraction per point/second of error change
+    double max_step = 0.1;                  ///< Largest fraction change per update (slew limit)
+    double min_fraction = 0.0;
+    double max_fraction = 1.0;              ///< Cap, e.g. to keep hot data served locally
+};
+
+/**
+ * @brief Proxies a controlled fraction of requests to shed just enough load
+ *
+ * update() runs a PID controller on local headroom: each sample moves
+ * the proxied fraction towards the value that holds CPU and memory at
+ * their setpoints, with conditional integration against windup and a
+ * slew limit, so load is shed and restored gradually instead of
+ * switching all traffic at once. decide_mode() is lock-free: keyed
+ * requests compare a hash of the key with the fraction, so a key keeps
+ * its mode while the fraction is steady and only the margin moves when
+ * it changes; keyless requests are spread evenly by error diffusion.
+ * Thread-safe.
+ */
+class TrafficShifter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    mutable std::mutex mutex_;
+    TrafficShifterOptions options_;
+    std::atomic<double> fraction_;
+    std::atomic<uint64_t> requests_{0};
+    double integral_ = 0.0;
+    double previous_error_ = 0.0;
+    std::optional<Clock::time_point> last_update_;
+
+public:
+    explicit TrafficShifter(const TrafficShifterOptions& options = {})
+        : options_(options), fraction_(options.min_fraction) {}
+
+    /**
+     * @brief Feed a local resource sample
+     * @return New proxied fraction
+     */
+    double update(const ResourceSample& sample, Clock::time_point now) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        double error = std::max(sample.cpu_usage_percent - options_.target_cpu_percent,
+                                sample.memory_usage_percent - options_.target_memory_percent);
+
+        double dt = last_update_
+            ? std::chrono::duration<double>(now - *last_update_).count() : 0.0;
+        last_update_ = now;
+        double derivative = dt > 0.0 ? (error - previous_error_) / dt : 0.0;
+        previous_error_ = error;
+
+        // Conditional integration: stop accumulating while saturated in the error's direction
+        double unclamped = options_.kp * error + options_.ki * integral_ + options_.kd * derivative;
+        if (!(unclamped >= options_.max_fraction && error > 0.0) &&
+            !(unclamped <= options_.min_fraction && error < 0.0)) {
+            integral_ += error * dt;
+        }
+
+        double output = std::clamp(
+            options_.kp * error + options_.ki * integral_ + options_.kd * derivative,
+            options_.min_fraction, options_.max_fraction);
+        double current = fraction_.load(std::memory_order_relaxed);
+        output = std::clamp(output, current - options_.max_step, current + options_.max_step);
+        fraction_.store(output, std::memory_order_relaxed);
+        return output;
+    }
+
+    /**
+     * @brief Mode for a keyed request (sticky per key)
+     */
+    [[nodiscard]] ProtocolMode decide_mode(std::string_view key) const {
+        uint64_t h = content_hash64(std::as_bytes(std::span<const char>(key.data(), key.size())));
+        double position = static_cast<double>(h >> 11) * 0x1.0p-53;
+        return position < fraction() ? ProtocolMode::Proxy : ProtocolMode::Endpoint;
+    }
+
+    /**
+     * @brief Mode for a keyless request (exactly fraction() of calls proxy)
+     */
+    [[nodiscard]] ProtocolMode decide_mode() {
+        double f = fraction();
+        auto n = static_cast<double>(requests_.fetch_add(1, std::memory_order_relaxed));
+        bool proxy = static_cast<uint64_t>((n + 1.0) * f) > static_cast<uint64_t>(n * f);
+        return proxy ? ProtocolMode::Proxy : ProtocolMode::Endpoint;
+    }
+
+    /**
+     * @brief Fraction of requests currently proxied
+     */
+    [[nodiscard]] double fraction() const {
+        return fraction_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Return to endpoint mode and clear controller state
+     */
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fraction_.store(options_.min_fraction, std::memory_order_relaxed);
+        integral_ = 0.0;
+        previous_error_ = 0.0;
+        last_update_.reset();
+    }
+};
+
+/**
+ * @brief Endpoint/proxy decision of a node (see README)
+ *
+ * Binary reproduces the original switch: everything is proxied while
+ * the node is over a setpoint. Weighted proxies the TrafficShifter's
+ * fraction, which avoids the oscillation of shedding all load and then
+ * snapping back. Thread-safe.
+ */
+class OffloadingController {
+public:
+    enum class ModePolicy {
+        Binary,     ///< Proxy everything while overloaded
+        Weighted    ///< Proxy a PID-controlled fraction
+    };
+
+private:
+    ModePolicy policy_;
+    TrafficShifter shifter_;
+    TrafficShifterOptions options_;
+    std::atomic<bool> overloaded_{false};
+
+public:
+    explicit OffloadingController(ModePolicy policy = ModePolicy::Weighted,
+                                  const TrafficShifterOptions& options = {})
+        : policy_(policy), shifter_(options), options_(options) {}
+
+    /**
+     * @brief Feed a local resource sample (call every sampling interval)
+     */
+    void observe(const ResourceSample& sample, TrafficShifter::Clock::time_point now) {
+        overloaded_.store(sample.cpu_usage_percent >= options_.target_cpu_percent ||
+                          sample.memory_usage_percent >= options_.target_memory_percent,
+                          std::memory_order_relaxed);
+        if (policy_ == ModePolicy::Weighted) {
+            shifter_.update(sample, now);
+        }
+    }
+
+    /**
+     * @brief Mode for a request on @p key
+     */
+    [[nodiscard]] ProtocolMode decide_mode(std::string_view key) const {
+        if (policy_ == ModePolicy::Binary) {
+            return overloaded_.load(std::memory_order_relaxed) ? ProtocolMode::Proxy
+                                                                : ProtocolMode::Endpoint;
+        }
+        return shifter_.decide_mode(key);
+    }
+
+    /**
+     * @brief Fraction of requests currently proxied
+     */
+    [[nodiscard]] double proxy_fraction() const {
+        if (policy_ == ModePolicy::Binary) {
+            return overloaded_.load(std::memory_order_relaxed) ? 1.0 : 0.0;
+        }
+        return shifter_.fraction();
+    }
+
+    [[nodiscard]] ModePolicy policy() const { return policy_; }
+};
+
+} // namespace redcomponent::offloading
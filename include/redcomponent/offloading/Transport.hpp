@@ -0,0 +1,248 @@
+/**
+ * @file Transport.hpp
+ * @brief Segment Transport Interface and Loopback Target
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#pragma once
+
+#include "IOffloadManager.hpp"
+#include "Checksum.hpp"
+#include "OffloadPolicy.hpp"
+#include "SegmentFrame.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace redcomponent::offloading {
+
+/**
+ * @brief Outcome of a transport operation
+ */
+enum class TransportStatus {
+    Ok,                 ///< Segment acknowledged by the target
+    NotConnected,       ///< No connection; call connect() first
+    ConnectionReset,    ///< Connection dropped; reconnect and resend
+    Timeout,            ///< No acknowledgement within the deadline
+    ChecksumMismatch    ///< Target rejected the segment as corrupted
+};
+
+/**
+ * @brief Convert TransportStatus to string
+ */
+inline std::string to_string(TransportStatus status) {
+    switch (status) {
+        case TransportStatus::Ok:               return "Ok";
+        case TransportStatus::NotConnected:     return "NotConnected";
+        case TransportStatus::ConnectionReset:  return "ConnectionReset";
+        case TransportStatus::Timeout:          return "Timeout";
+        case TransportStatus::ChecksumMismatch: return "ChecksumMismatch";
+        default:                                return "Unknown";
+    }
+}
+
+/**
+ * @brief Sleep function used for delays (injectable for virtual time)
+ */
+using SleepFunction = std::function<void(std::chrono::microseconds)>;
+
+/**
+ * @brief Default SleepFunction (real sleep)
+ */
+inline void real_sleep(std::chrono::microseconds duration) {
+    if (duration.count() > 0) {
+        std::this_thread::sleep_for(duration);
+    }
+}
+
+/**
+ * @brief Segment transport to one target node
+ *
+ * send_segment() blocks until the target acknowledges (or rejects) the
+ * segment. Implementations are used by one sender at a time.
+ */
+class ITransport {
+public:
+    virtual ~ITransport() = default;
+
+    /**
+     * @brief Open a connection to @p node
+     * @return true if connected
+     */
+    virtual bool connect(const TargetNode& node) = 0;
+
+    /**
+     * @brief Close the connection (no-op when not connected)
+     */
+    virtual void disconnect() = 0;
+
+    [[nodiscard]] virtual bool is_connected() const = 0;
+
+    /**
+     * @brief Send one segment and wait for its acknowledgement
+     * @param segment_id Segment sequence number
+     * @param payload Segment bytes
+     * @param checksum CRC32C of @p payload computed by the sender
+     */
+    virtual TransportStatus send_segment(uint64_t segment_id,
+                                         std::span<const std::byte> payload,
+                                         uint32_t checksum) = 0;
+};
+
+/**
+ * @brief In-process target that stores and verifies received segments
+ *
+ * Thread-safe; several LoopbackTransports may deliver to one target.
+ */
+class LoopbackTarget {
+private:
+    mutable std::mutex mutex_;
+    std::map<uint64_t, std::vector<std::byte>> segments_;
+    size_t rejected_ = 0;
+    size_t wire_bytes_ = 0;
+
+public:
+    /**
+     * @brief Parse, verify and store one segment frame (as a real target does)
+     */
+    TransportStatus receive_frame(std::span<const std::byte> wire) {
+        auto frame = parse_frame(wire);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            wire_bytes_ += wire.size();
+            if (frame.status != FrameParseStatus::Ok || frame.consumed != wire.size()) {
+                rejected_++;
+                return TransportStatus::ChecksumMismatch;
+            }
+        }
+        return receive(frame.header.segment_id, frame.payload, frame.header.checksum);
+    }
+
+    /**
+     * @brief Verify and store a segment
+     */
+    TransportStatus receive(uint64_t segment_id, std::span<const std::byte> payload,
+                            uint32_t checksum) {
+        bool valid = crc32c(payload) == checksum;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!valid) {
+            rejected_++;
+            return TransportStatus::ChecksumMismatch;
+        }
+        segments_[segment_id].assign(payload.begin(), payload.end());
+        return TransportStatus::Ok;
+    }
+
+    [[nodiscard]] size_t segment_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return segments_.size();
+    }
+
+    [[nodiscard]] size_t rejected_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return rejected_;
+    }
+
+    /**
+     * @brief Frame bytes received, headers included
+     */
+    [[nodiscard]] size_t wire_bytes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return wire_bytes_;
+    }
+
+    [[nodiscard]] std::optional<std::vector<std::byte>> segment(uint64_t segment_id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = segments_.find(segment_id);
+        if (it == segments_.end()) return std::nullopt;
+        return it->second;
+    }
+};
+
+/**
+ * @brief Transport delivering segment frames to a LoopbackTarget
+ *
+ * Each segment is framed and gathered into a reused wire buffer standing
+ * in for the socket, so the loopback path exercises the same encoding
+ * and parsing as a real target. ITransport carries no offset; frames
+ * use 0.
+ */
+class LoopbackTransport : public ITransport {
+private:
+    LoopbackTarget& target_;
+    bool connected_ = false;
+    std::vector<std::byte> wire_;
+
+public:
+    explicit LoopbackTransport(LoopbackTarget& target) : target_(target) {}
+
+    bool connect(const TargetNode&) override {
+        connected_ = true;
+        return true;
+    }
+
+    void disconnect() override { connected_ = false; }
+
+    [[nodiscard]] bool is_connected() const override { return connected_; }
+
+    TransportStatus send_segment(uint64_t segment_id, std::span<const std::byte> payload,
+                                 uint32_t checksum) override {
+        if (!connected_) return TransportStatus::NotConnected;
+        auto frame = make_frame(segment_id, 0, SegmentCodec::None, payload, checksum);
+        wire_.clear();
+        for (auto part : frame.gather()) {
+            wire_.insert(wire_.end(), part.begin(), part.end());
+        }
+        return target_.receive_frame(wire_);
+    }
+};
+
+/**
+ * @brief Result of send_with_retry()
+ */
+struct SendOutcome {
+    TransportStatus status = TransportStatus::NotConnected;
+    size_t attempts = 0;                    ///< Sends attempted (1 = no retry)
+    size_t reconnects = 0;                  ///< Reconnects after resets
+};
+
+/**
+ * @brief Send a segment, retrying per OffloadConfig
+ *
+ * Failed attempts are retried after OffloadPolicy::retry_delay; a reset
+ * or dropped connection is re-established to @p node before resending.
+ */
+inline SendOutcome send_with_retry(ITransport& transport, const TargetNode& node,
+                                   uint64_t segment_id, std::span<const std::byte> payload,
+                                   uint32_t checksum, const OffloadConfig& config,
+                                   const SleepFunction& sleep = real_sleep) {
+    SendOutcome outcome;
+    for (;;) {
+        if (!transport.is_connected()) {
+            if (outcome.attempts > 0) outcome.reconnects++;
+            if (!transport.connect(node)) {
+                outcome.status = TransportStatus::NotConnected;
+            }
+        }
+        if (transport.is_connected()) {
+            outcome.status = transport.send_segment(segment_id, payload, checksum);
+        }
+        outcome.attempts++;
+        if (outcome.status == TransportStatus::Ok ||
+            !OffloadPolicy::may_retry(outcome.attempts - 1, config)) {
+            return outcome;
+        }
+        sleep(OffloadPolicy::retry_delay(outcome.attempts, config));
+    }
+}
+
+} // namespace redcomponent::offloading
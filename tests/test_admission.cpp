@@ -0,0 +1,113 @@
+/**
+ * @file test_admission.cpp
+ * @brief Unit Tests for Target-Side Admission Control
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lease Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(TargetAdmissionTest, GrantsUpToLimitAndReclaimsExpiredLeases) {
+    AdmissionOptions options;
+    options.initial_limit = 2;
+    options.lease_ttl = 10s;
+    TargetAdmission admission("node1", 10, options);
+    auto t0 = TargetAdmission::Clock::now();
+
+    auto a = admission.try_acquire(t0);
+    auto b = admission.try_acquire(t0);
+    ASSERT_TRUE(a && b);
+    EXPECT_NE(a->lease_id, b->lease_id);
+    EXPECT_FALSE(admission.try_acquire(t0));
+    EXPECT_FALSE(admission.has_capacity(t0));
+    EXPECT_EQ(admission.rejected(), 1u);
+
+    EXPECT_TRUE(admission.release(a->lease_id));
+    EXPECT_TRUE(admission.try_acquire(t0 + 1s));
+
+    // b is renewed, the other lease's holder went silent
+    EXPECT_TRUE(admission.renew(*b, t0 + 9s));
+    EXPECT_TRUE(admission.try_acquire(t0 + 12s));
+    EXPECT_EQ(admission.active_leases(), 2u);
+    EXPECT_FALSE(admission.renew(*a, t0 + 12s));
+}
+
+TEST(TargetAdmissionTest, LimitAdaptsToObservedLatency) {
+    AdmissionOptions options;
+    options.initial_limit = 2;
+    TargetAdmission admission("node1", 8, options);
+
+    for (int i = 0; i < 100; ++i) {
+        admission.record_latency(1000us);
+    }
+    EXPECT_EQ(admission.limit(), 8u);                  // Grows up to max_concurrent_offloads
+    EXPECT_EQ(admission.baseline_latency(), 1000us);
+
+    for (int i = 0; i < 30; ++i) {
+        admission.record_latency(10000us);             // Queueing on the target
+    }
+    EXPECT_EQ(admission.limit(), options.min_limit);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Manager Integration Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(AdmissionIntegrationTest, ConcurrentSourcesSpreadAcrossTargets) {
+    auto registry = std::make_shared<AdmissionRegistry>();     // 2 slots per target initially
+    std::vector<std::unique_ptr<MockOffloadManager>> sources;
+    std::map<std::string, int> per_target;
+    int rejected = 0;
+
+    for (int i = 0; i < 8; ++i) {
+        auto manager = std::make_unique<MockOffloadManager>();
+        manager->set_admission_registry(registry);
+        if (manager->auto_select_target_node() && manager->start_offload()) {
+            per_target[manager->get_current_target()->node_id]++;
+            EXPECT_TRUE(manager->get_admission_lease().has_value());
+        } else {
+            rejected++;
+        }
+        sources.push_back(std::move(manager));
+    }
+
+    // The "best" node takes its share, then sources move on instead of piling up
+    EXPECT_EQ(per_target.size(), 3u);
+    for (const auto& [node, count] : per_target) {
+        EXPECT_EQ(count, 2) << node;
+    }
+    EXPECT_EQ(rejected, 2);
+
+    // Completion returns the slot and the node's active count
+    sources[0]->simulate_complete(true);
+    EXPECT_FALSE(sources[0]->get_admission_lease().has_value());
+    auto freed = sources[0]->get_current_target()->node_id;
+    EXPECT_EQ(registry->find(freed)->active_leases(), 1u);
+    EXPECT_TRUE(sources[6]->auto_select_target_node());
+    EXPECT_EQ(sources[6]->get_current_target()->node_id, freed);
+}
+
+TEST(AdmissionIntegrationTest, StartTracksActiveOffloadCount) {
+    MockOffloadManager manager;
+    ASSERT_TRUE(manager.select_target_node("node2"));
+    ASSERT_TRUE(manager.start_offload());
+    auto nodes = manager.get_available_nodes();
+    EXPECT_EQ(nodes[1].active_offload_count, 1u);
+    EXPECT_EQ(manager.get_current_target()->active_offload_count, 1u);
+
+    ASSERT_TRUE(manager.cancel_offload());
+    EXPECT_EQ(manager.get_available_nodes()[1].active_offload_count, 0u);
+}
@@ -0,0 +1,122 @@
+/**
+ * @file test_async.cpp
+ * @brief Unit Tests for the Coroutine Offload API
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../include/redcomponent/offloading/AsyncOffload.hpp"
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+
+namespace {
+
+Task<OffloadResult> offload(AsyncOffloadManager& async, std::vector<std::string> ids) {
+    co_return co_await async.offload_async(std::move(ids));
+}
+
+Task<void> wait(AsyncOffloadManager& async, int& finished) {
+    auto result = co_await async.wait_for_completion();
+    if (result.success) ++finished;
+}
+
+Task<size_t> count_progress(ProgressStream stream, size_t& last_bytes) {
+    size_t updates = 0;
+    while (auto progress = co_await stream.next()) {
+        ++updates;
+        last_bytes = progress->transferred_bytes;
+    }
+    co_return updates;
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Async API Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(AsyncOffloadTest, AwaitOffloadResult) {
+    MockOffloadManager manager;
+    QueueExecutor executor;
+    AsyncOffloadManager async(manager, executor);
+    ASSERT_TRUE(manager.select_target_node("node1"));
+
+    auto task = offload(async, {"shard-1", "shard-2"});
+    task.start();
+    EXPECT_FALSE(task.done());
+    EXPECT_EQ(manager.get_status(), OffloadStatus::Transferring);
+    EXPECT_EQ(manager.get_offload_data_ids().size(), 2u);
+
+    manager.simulate_complete(true);
+    EXPECT_FALSE(task.done());              // Resumption is posted, not inline
+    executor.run_pending();
+
+    ASSERT_TRUE(task.done());
+    auto result = task.result();
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(result.target_node.node_id, "node1");
+}
+
+TEST(AsyncOffloadTest, StartFailureResolvesImmediately) {
+    MockOffloadManager manager;
+    QueueExecutor executor;
+    AsyncOffloadManager async(manager, executor);
+
+    auto task = offload(async, {"shard-1"});
+    task.start();
+
+    ASSERT_TRUE(task.done());
+    auto result = task.result();
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(result.error_message, "No target node selected");
+}
+
+TEST(AsyncOffloadTest, ManyWaitersWithoutThreads) {
+    MockOffloadManager manager;
+    QueueExecutor executor;
+    AsyncOffloadManager async(manager, executor);
+    ASSERT_TRUE(manager.select_target_node("node1"));
+    ASSERT_TRUE(manager.start_offload());
+
+    int finished = 0;
+    std::vector<Task<void>> waiters;
+    for (int i = 0; i < 1000; ++i) {
+        waiters.push_back(wait(async, finished));
+        waiters.back().start();
+    }
+
+    manager.simulate_complete(true);
+    EXPECT_EQ(executor.run_pending(), 1000u);
+    EXPECT_EQ(finished, 1000);
+}
+
+TEST(AsyncOffloadTest, ProgressStreamEndsOnCompletion) {
+    MockOffloadManager manager;
+    QueueExecutor executor;
+    AsyncOffloadManager async(manager, executor);
+    ASSERT_TRUE(manager.select_target_node("node1"));
+    ASSERT_TRUE(manager.start_offload());
+
+    size_t last_bytes = 0;
+    auto task = count_progress(async.progress(), last_bytes);
+
+    // Updates arriving before the consumer waits coalesce into the latest
+    manager.simulate_progress(1024);
+    manager.simulate_progress(1024);
+    task.start();
+    EXPECT_EQ(last_bytes, 2048u);
+
+    manager.simulate_progress(1024);
+    executor.run_pending();
+    EXPECT_EQ(last_bytes, 3072u);
+
+    manager.simulate_complete(true);
+    executor.run_pending();
+
+    ASSERT_TRUE(task.done());
+    EXPECT_EQ(task.result(), 2u);
+}
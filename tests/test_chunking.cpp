@@ -0,0 +1,126 @@
+/**
+ * @file test_chunking.cpp
+ * @brief Unit Tests for Content-Defined Chunking and Deduplication
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "../include/redcomponent/offloading/ContentChunker.hpp"
+
+using namespace redcomponent::offloading;
+
+namespace {
+
+std::vector<std::byte> random_bytes(size_t size, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<std::byte> data(size);
+    for (auto& b : data) {
+        b = static_cast<std::byte>(rng() & 0xFF);
+    }
+    return data;
+}
+
+// Byte-at-a-time reference for the two-bytes-per-step loop
+size_t reference_boundary(std::span<const std::byte> data, const ChunkerOptions& o) {
+    size_t n = std::min(data.size(), o.max_size);
+    if (n <= o.min_size) return n;
+    size_t normal = std::min(o.avg_size, n);
+    auto bits = static_cast<unsigned>(std::bit_width(o.avg_size) - 1);
+    uint64_t small = detail::spread_mask(bits + 2);
+    uint64_t large = detail::spread_mask(bits - 2);
+    uint64_t h = 0;
+    for (size_t i = o.min_size; i < n; ++i) {
+        h = (h << 1) + detail::kGearTable[static_cast<uint8_t>(data[i])];
+        if (!(h & (i < normal ? small : large))) return i + 1;
+    }
+    return n;
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Chunker Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ContentChunkerTest, ChunksCoverInputWithinBounds) {
+    ContentChunker chunker;
+    auto data = random_bytes(4 * 1024 * 1024, 1);
+    auto chunks = chunker.chunk(data);
+
+    uint64_t offset = 0;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        EXPECT_EQ(chunks[i].offset, offset);
+        EXPECT_LE(chunks[i].size, chunker.options().max_size);
+        if (i + 1 < chunks.size()) EXPECT_GE(chunks[i].size, chunker.options().min_size);
+        offset += chunks[i].size;
+    }
+    EXPECT_EQ(offset, data.size());
+
+    // Normalized chunking keeps the mean near avg_size
+    double mean = static_cast<double>(data.size()) / static_cast<double>(chunks.size());
+    EXPECT_GT(mean, 0.5 * chunker.options().avg_size);
+    EXPECT_LT(mean, 2.0 * chunker.options().avg_size);
+}
+
+TEST(ContentChunkerTest, TwoByteRollingMatchesReference) {
+    ChunkerOptions options{2048, 8192, 32768};
+    ContentChunker chunker(options);
+    auto data = random_bytes(1024 * 1024, 2);
+
+    std::span<const std::byte> rest(data);
+    while (!rest.empty()) {
+        size_t expected = reference_boundary(rest, chunker.options());
+        ASSERT_EQ(chunker.next_boundary(rest), expected);
+        rest = rest.subspan(expected);
+    }
+}
+
+TEST(ContentChunkerTest, BoundariesSurviveInsertedBytes) {
+    ContentChunker chunker;
+    auto data = random_bytes(2 * 1024 * 1024, 3);
+    auto shifted = data;
+    shifted.insert(shifted.begin() + 1000, {std::byte{1}, std::byte{2}, std::byte{3}});
+
+    std::unordered_set<ChunkFingerprint, ChunkFingerprintHash> original;
+    for (const auto& c : chunker.chunk(data)) {
+        original.insert(c.fingerprint);
+    }
+    auto after = chunker.chunk(shifted);
+    size_t reused = 0;
+    for (const auto& c : after) {
+        reused += original.count(c.fingerprint);
+    }
+    EXPECT_GE(reused + 2, after.size());    // Only the chunk(s) around the edit change
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Deduplication Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ChunkDedupTest, SkipsChunksPresentOnTargetAndRepeatedInStream) {
+    ContentChunker chunker(ChunkerOptions::for_config(OffloadConfig{}));
+    auto shard = random_bytes(8 * 1024 * 1024, 4);
+    ChunkIndex target;
+
+    auto first = plan_dedup(chunker, shard, target);
+    EXPECT_EQ(first.send_bytes, shard.size());
+    for (size_t i : first.to_send) {
+        target.add(first.recipe[i].fingerprint, first.recipe[i].size);
+    }
+    EXPECT_EQ(target.stored_bytes(), shard.size());
+
+    // Replica of the shard with a small edit, doubled (snapshot + replica)
+    auto replica = shard;
+    replica[123456] ^= std::byte{0xFF};
+    replica.insert(replica.end(), replica.begin(), replica.end());
+
+    auto second = plan_dedup(chunker, replica, target);
+    EXPECT_EQ(second.total_bytes, replica.size());
+    EXPECT_LT(second.send_bytes, 2u * chunker.options().max_size);
+    EXPECT_GT(second.savings(), 0.9);
+}
@@ -0,0 +1,174 @@
+/**
+ * @file test_connection_pool.cpp
+ * @brief Unit Tests for the Pooled, Multiplexed Target Connections
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../include/redcomponent/offloading/ConnectionPool.hpp"
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+namespace {
+
+// Loopback transport counting handshakes; tests can drop it like a peer reset
+class CountingTransport : public ITransport {
+private:
+    LoopbackTransport inner_;
+
+public:
+    size_t handshakes = 0;
+
+    explicit CountingTransport(LoopbackTarget& target) : inner_(target) {}
+
+    bool connect(const TargetNode& node) override {
+        handshakes++;
+        return inner_.connect(node);
+    }
+
+    void disconnect() override { inner_.disconnect(); }
+
+    [[nodiscard]] bool is_connected() const override { return inner_.is_connected(); }
+
+    TransportStatus send_segment(uint64_t segment_id, std::span<const std::byte> payload,
+                                 uint32_t checksum) override {
+        return inner_.send_segment(segment_id, payload, checksum);
+    }
+};
+
+struct PoolFixture {
+    LoopbackTarget target;
+    std::vector<CountingTransport*> created;
+    std::chrono::steady_clock::time_point now{};
+
+    ConnectionPool make_pool(const ConnectionPoolOptions& options = {}) {
+        return ConnectionPool(
+            [this](const TargetNode&) {
+                auto transport = std::make_unique<CountingTransport>(target);
+                created.push_back(transport.get());
+                return transport;
+            },
+            options, [this] { return now; });
+    }
+};
+
+TargetNode pool_node() {
+    return MockOffloadManager::create_mock_node("node1", "10.0.0.1", 1ULL << 30);
+}
+
+std::vector<std::byte> payload(size_t size) {
+    return std::vector<std::byte>(size, std::byte{0x5A});
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Pool Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ConnectionPoolTest, SequentialOffloadsReuseOneWarmConnection) {
+    PoolFixture fixture;
+    auto pool = fixture.make_pool();
+    auto data = payload(1024);
+
+    for (uint64_t offload = 0; offload < 20; ++offload) {
+        auto stream = pool.open_stream(pool_node());
+        ASSERT_TRUE(stream.has_value());
+        EXPECT_EQ(stream->send_segment(offload, data, crc32c(data)), TransportStatus::Ok);
+    }
+    EXPECT_EQ(pool.stats().connects, 1u);
+    EXPECT_EQ(pool.stats().reuses, 19u);
+    EXPECT_EQ(fixture.created.front()->handshakes, 1u);
+    EXPECT_EQ(fixture.target.segment_count(), 20u);
+}
+
+TEST(ConnectionPoolTest, MultiplexesStreamsBeforeOpeningConnections) {
+    PoolFixture fixture;
+    ConnectionPoolOptions options;
+    options.max_connections_per_node = 2;
+    options.max_streams_per_connection = 4;
+    auto pool = fixture.make_pool(options);
+
+    std::vector<ConnectionPool::Stream> streams;
+    for (int i = 0; i < 8; ++i) {
+        auto stream = pool.open_stream(pool_node());
+        ASSERT_TRUE(stream.has_value());
+        streams.push_back(std::move(*stream));
+    }
+    EXPECT_EQ(pool.connection_count("node1"), 2u);
+    EXPECT_FALSE(pool.open_stream(pool_node()).has_value());
+    EXPECT_EQ(pool.stats().rejected, 1u);
+
+    // Concurrent senders share the connections safely
+    std::vector<std::thread> senders;
+    for (size_t i = 0; i < streams.size(); ++i) {
+        senders.emplace_back([&, i] {
+            auto data = payload(4096);
+            for (uint64_t s = 0; s < 50; ++s) {
+                EXPECT_EQ(streams[i].send_segment(i * 1000 + s, data, crc32c(data)),
+                          TransportStatus::Ok);
+            }
+        });
+    }
+    for (auto& sender : senders) {
+        sender.join();
+    }
+    EXPECT_EQ(fixture.target.segment_count(), 400u);
+
+    streams.pop_back();
+    EXPECT_TRUE(pool.open_stream(pool_node()).has_value());
+}
+
+TEST(ConnectionPoolTest, KeepAliveReconnectsIdleDropsAndClosesExpired) {
+    PoolFixture fixture;
+    ConnectionPoolOptions options;
+    options.keepalive_interval = 15s;
+    options.idle_timeout = 60s;
+    auto pool = fixture.make_pool(options);
+
+    { auto stream = pool.open_stream(pool_node()); }
+    fixture.created.front()->disconnect();      // Peer closed the idle connection
+
+    fixture.now += 20s;
+    pool.maintain();
+    EXPECT_EQ(pool.stats().keepalive_probes, 1u);
+    EXPECT_EQ(fixture.created.front()->handshakes, 2u);    // Re-established off the send path
+    EXPECT_TRUE(fixture.created.front()->is_connected());
+
+    fixture.now += 60s;
+    pool.maintain();
+    EXPECT_EQ(pool.connection_count("node1"), 0u);
+    EXPECT_EQ(pool.stats().idle_closed, 1u);
+}
+
+TEST(ConnectionPoolTest, SendWithRetryRecoversFromResetThroughPool) {
+    PoolFixture fixture;
+    auto pool = fixture.make_pool();
+    PooledTransport transport(pool);
+    OffloadConfig config;
+    config.max_retries = 3;
+    auto data = payload(2048);
+    auto node = pool_node();
+
+    ASSERT_TRUE(transport.connect(node));
+    fixture.created.front()->disconnect();      // Reset mid-offload
+
+    auto outcome = send_with_retry(transport, node, 1, data, crc32c(data), config,
+                                   [](std::chrono::microseconds) {});
+    EXPECT_EQ(outcome.status, TransportStatus::Ok);
+    EXPECT_EQ(outcome.attempts, 2u);
+    EXPECT_EQ(outcome.reconnects, 1u);
+    EXPECT_EQ(pool.connection_count("node1"), 2u);      // Broken one awaits maintain()
+
+    transport.disconnect();
+    pool.maintain();
+    EXPECT_EQ(pool.connection_count("node1"), 1u);
+}
@@ -0,0 +1,107 @@
+/**
+ * @file test_delta.cpp
+ * @brief Unit Tests for Change Tracking and Delta Offloads
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Change Tracker Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ChangeTrackerTest, FirstPlanIsFullThenOnlyWrittenPages) {
+    ChangeTracker tracker(10 * 4096 + 100, 4096);
+    EXPECT_EQ(tracker.page_count(), 11u);
+
+    auto first = tracker.plan("node1");
+    EXPECT_TRUE(first.full);
+    EXPECT_EQ(first.bytes, 10u * 4096 + 100);
+    tracker.commit(first);
+    EXPECT_TRUE(tracker.plan("node1").empty());
+
+    tracker.record_write(4096 * 3 + 10, 5000);       // Pages 3 and 4
+    tracker.record_write(10 * 4096 + 50, 10);        // Partial last page
+    auto delta = tracker.plan("node1");
+    EXPECT_FALSE(delta.full);
+    EXPECT_EQ(delta.pages, (std::vector<size_t>{3, 4, 10}));
+    EXPECT_EQ(delta.bytes, 2u * 4096 + 100);
+    EXPECT_NEAR(delta.ratio(), (2.0 * 4096 + 100) / (10.0 * 4096 + 100), 1e-9);
+
+    // Other targets still need everything
+    EXPECT_EQ(tracker.plan("node2").pages.size(), 11u);
+}
+
+TEST(ChangeTrackerTest, WritesDuringTransferStayDirty) {
+    ChangeTracker tracker(4 * 4096, 4096);
+    tracker.commit(tracker.plan("node1"));
+
+    tracker.record_write(0, 1);
+    auto delta = tracker.plan("node1");
+    tracker.record_write(100, 1);                    // Lands while delta is in flight
+    tracker.commit(delta);
+
+    EXPECT_EQ(tracker.plan("node1").pages, (std::vector<size_t>{0}));
+}
+
+TEST(ChangeTrackerTest, ContentPlanDetectsUntrackedChanges) {
+    std::vector<std::byte> data(8 * 4096, std::byte{1});
+    ChangeTracker tracker(data.size(), 4096);
+
+    auto first = tracker.plan_by_content("node1", data);
+    EXPECT_EQ(first.pages.size(), 8u);
+    tracker.commit(first);
+    EXPECT_TRUE(tracker.plan_by_content("node1", data).empty());
+
+    data[5 * 4096 + 7] = std::byte{2};               // Written without record_write
+    auto delta = tracker.plan_by_content("node1", data);
+    EXPECT_EQ(delta.pages, (std::vector<size_t>{5}));
+    EXPECT_EQ(delta.bytes, 4096u);
+}
+
+TEST(ChangeTrackerTest, ResizeMarksNewAndBoundaryPages) {
+    ChangeTracker tracker(4096 + 10, 4096);
+    tracker.commit(tracker.plan("node1"));
+    tracker.resize(3 * 4096);
+    EXPECT_EQ(tracker.plan("node1").pages, (std::vector<size_t>{1, 2}));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Delta Offload Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(DeltaOffloadTest, RepeatOffloadShipsOnlyChangedSegments) {
+    MockOffloadManager manager;
+    auto tracker = std::make_shared<ChangeTracker>(10ULL * 1024 * 1024 * 1024);
+    manager.set_change_tracker(tracker);
+
+    ASSERT_TRUE(manager.select_target_node("node1"));
+    ASSERT_TRUE(manager.start_offload());
+    EXPECT_EQ(manager.get_progress().total_bytes, 10ULL * 1024 * 1024 * 1024);
+    manager.simulate_complete(true);
+    manager.force_status(OffloadStatus::Idle);
+
+    // Mostly cold shard: 300 x 1MB pages touched
+    for (uint64_t i = 0; i < 300; ++i) {
+        tracker->record_write(i * 30 * 1024 * 1024, 4096);
+    }
+    ASSERT_TRUE(manager.start_offload());
+    auto progress = manager.get_progress();
+    EXPECT_EQ(progress.total_bytes, 300u * 1024 * 1024);
+    EXPECT_EQ(progress.segments_total, 300u);
+    ASSERT_TRUE(manager.get_delta_plan().has_value());
+    EXPECT_FALSE(manager.get_delta_plan()->full);
+
+    // Failed delta is not committed
+    manager.simulate_complete(false);
+    manager.force_status(OffloadStatus::Idle);
+    ASSERT_TRUE(manager.start_offload());
+    EXPECT_EQ(manager.get_progress().segments_total, 300u);
+}
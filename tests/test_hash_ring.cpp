@@ -0,0 +1,131 @@
+/**
+ * @file test_hash_ring.cpp
+ * @brief Unit Tests for the Consistent Hash Placement Ring
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+
+namespace {
+
+constexpr size_t kGiB = 1024ULL * 1024 * 1024;
+
+TargetNode ring_node(const std::string& id, size_t total_storage) {
+    auto node = MockOffloadManager::create_mock_node(id, "10.0.0.1", total_storage / 2);
+    node.total_storage_bytes = total_storage;
+    return node;
+}
+
+std::map<std::string, std::string> owners(const HashRing& ring, size_t keys) {
+    std::map<std::string, std::string> out;
+    for (size_t k = 0; k < keys; ++k) {
+        std::string key = "data-" + std::to_string(k);
+        out[key] = *ring.owner(key);
+    }
+    return out;
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Ring Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(HashRingTest, SpreadsKeysInProportionToCapacity) {
+    HashRing ring;
+    ring.add_node(ring_node("small", 512 * kGiB));
+    ring.add_node(ring_node("large", 1536 * kGiB));
+    EXPECT_EQ(ring.vnode_count("small"), 64u);
+    EXPECT_EQ(ring.vnode_count("large"), 192u);
+
+    std::map<std::string, size_t> counts;
+    for (const auto& [key, node] : owners(ring, 20000)) {
+        counts[node]++;
+    }
+    double large_share = static_cast<double>(counts["large"]) / 20000.0;
+    EXPECT_NEAR(large_share, 0.75, 0.05);
+}
+
+TEST(HashRingTest, JoinAndLeaveMoveOnlyTheirOwnKeys) {
+    HashRing ring;
+    for (int i = 0; i < 4; ++i) {
+        ring.add_node(ring_node("node" + std::to_string(i), 1024 * kGiB));
+    }
+    auto before = owners(ring, 10000);
+
+    ring.add_node(ring_node("node4", 1024 * kGiB));
+    auto after_join = owners(ring, 10000);
+    size_t moved = 0;
+    for (const auto& [key, node] : after_join) {
+        if (node != before[key]) {
+            EXPECT_EQ(node, "node4");   // Keys only move onto the new node
+            moved++;
+        }
+    }
+    EXPECT_NEAR(static_cast<double>(moved) / 10000.0, 0.2, 0.05);
+
+    ring.remove_node("node4");
+    EXPECT_EQ(owners(ring, 10000), before);
+
+    // Same membership in another order resolves identically (no central directory)
+    HashRing other;
+    for (int i = 3; i >= 0; --i) {
+        other.add_node(ring_node("node" + std::to_string(i), 1024 * kGiB));
+    }
+    EXPECT_EQ(owners(other, 10000), before);
+}
+
+TEST(HashRingTest, BoundedLoadCapsEveryNode) {
+    HashRingOptions options;
+    options.load_factor = 1.25;
+    HashRing ring(options);
+    for (int i = 0; i < 5; ++i) {
+        ring.add_node(ring_node("node" + std::to_string(i), 256 * kGiB));
+    }
+
+    const size_t keys = 5000;
+    for (size_t k = 0; k < keys; ++k) {
+        std::string key = "data-" + std::to_string(k);
+        auto placed = ring.place(key, 1);
+        ASSERT_TRUE(placed.has_value());
+        // A placed key is always one of its ring candidates
+        auto candidates = ring.candidates(key, 5);
+        EXPECT_NE(std::find(candidates.begin(), candidates.end(), *placed), candidates.end());
+    }
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_LE(ring.load_bytes("node" + std::to_string(i)), keys * 125 / 100 / 5 + 1);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Manager Integration Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(HashRingTest, ManagerPlacesDataDeterministically) {
+    MockOffloadManager manager;
+    ASSERT_TRUE(manager.select_target_for_data("table-42", 1));
+    auto first = manager.get_current_target()->node_id;
+    EXPECT_EQ(first, *manager.get_hash_ring().owner("table-42"));
+
+    // An unrelated node leaving does not move the data
+    auto nodes = manager.get_available_nodes();
+    std::erase_if(nodes, [&](const TargetNode& n) { return n.node_id != first; });
+    nodes.push_back(ring_node("spare", 64 * kGiB));
+    manager.set_available_nodes(nodes);
+    manager.set_hash_ring_options(HashRingOptions{});
+    ASSERT_TRUE(manager.select_target_for_data("table-42", 1));
+    EXPECT_EQ(manager.get_current_target()->node_id,
+              *manager.get_hash_ring().owner("table-42"));
+
+    manager.set_available_nodes({});
+    EXPECT_FALSE(manager.select_target_for_data("table-42", 1));
+}
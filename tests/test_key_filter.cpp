@@ -0,0 +1,110 @@
+/**
+ * @file test_key_filter.cpp
+ * @brief Unit Tests for Cuckoo Filter Key Summaries
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Cuckoo Filter Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(CuckooFilterTest, NoFalseNegativesAndRareFalsePositives) {
+    CuckooFilter filter(20000);
+    for (int i = 0; i < 20000; ++i) {
+        ASSERT_TRUE(filter.insert("data-" + std::to_string(i)));
+    }
+    EXPECT_GT(filter.load_factor(), 0.5);
+    for (int i = 0; i < 20000; ++i) {
+        EXPECT_TRUE(filter.contains("data-" + std::to_string(i)));
+    }
+
+    size_t false_positives = 0;
+    for (int i = 0; i < 100000; ++i) {
+        false_positives += filter.contains("other-" + std::to_string(i));
+    }
+    EXPECT_LT(false_positives, 100u);       // < 0.1%
+}
+
+TEST(CuckooFilterTest, ImageRoundTripsAndRejectsCorruption) {
+    CuckooFilter filter(1000);
+    for (int i = 0; i < 800; ++i) {
+        filter.insert("data-" + std::to_string(i));
+    }
+    auto image = filter.serialize();
+
+    auto restored = CuckooFilter::deserialize(image);
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->size(), filter.size());
+    for (int i = 0; i < 800; ++i) {
+        EXPECT_TRUE(restored->contains("data-" + std::to_string(i)));
+    }
+
+    image[40] ^= std::byte{0x10};
+    EXPECT_FALSE(CuckooFilter::deserialize(image).has_value());
+    EXPECT_FALSE(CuckooFilter::deserialize(std::span(image).first(20)).has_value());
+}
+
+TEST(CuckooFilterTest, NodeSummaryGrowsAndIsReplacedByRemote) {
+    NodeKeyFilters filters(64);
+    for (int i = 0; i < 5000; ++i) {
+        filters.add("node1", "data-" + std::to_string(i));
+    }
+    EXPECT_EQ(filters.key_count("node1"), 5000u);
+    for (int i = 0; i < 5000; ++i) {
+        ASSERT_TRUE(filters.might_contain("node1", "data-" + std::to_string(i)));
+    }
+    EXPECT_FALSE(filters.might_contain("node2", "data-1"));
+
+    // The target's own summary replaces what the source had recorded
+    NodeKeyFilters target(64);
+    target.add("node1", "recalled-elsewhere");
+    ASSERT_TRUE(filters.merge_remote("node1", target.serialize("node1")));
+    EXPECT_TRUE(filters.might_contain("node1", "recalled-elsewhere"));
+    EXPECT_EQ(filters.key_count("node1"), 1u);
+
+    auto bad = target.serialize("node1");
+    bad.back() ^= std::byte{0xFF};
+    EXPECT_FALSE(filters.merge_remote("node1", bad));
+    EXPECT_EQ(filters.candidates("recalled-elsewhere"), std::vector<std::string>{"node1"});
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Manager Integration Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(CuckooFilterTest, ManagerAddsIdsAsSegmentsCompleteAndExchangesOnRefresh) {
+    MockOffloadManager manager;
+    auto filters = std::make_shared<NodeKeyFilters>();
+    manager.set_key_filters(filters);
+
+    ASSERT_TRUE(manager.select_target_node("node2"));
+    ASSERT_TRUE(manager.start_offload({"a", "b", "c", "d"}));   // 100 segments, 25 per id
+    for (int i = 0; i < 50; ++i) {
+        manager.simulate_progress(1024 * 1024);
+    }
+    EXPECT_TRUE(filters->might_contain("node2", "a"));
+    EXPECT_TRUE(filters->might_contain("node2", "b"));
+    EXPECT_FALSE(filters->might_contain("node2", "c"));
+    manager.simulate_complete(true);
+    EXPECT_TRUE(filters->might_contain("node2", "d"));
+
+    NodeKeyFilters remote;
+    remote.add("node1", "z");
+    manager.set_filter_exchange_hook([&remote](const TargetNode& node)
+            -> std::optional<std::vector<std::byte>> {
+        if (node.node_id != "node1") return std::nullopt;
+        return remote.serialize("node1");
+    });
+    ASSERT_TRUE(manager.refresh_nodes());
+    EXPECT_TRUE(filters->might_contain("node1", "z"));
+    EXPECT_TRUE(filters->might_contain("node2", "a"));      // Kept: node2 sent nothing
+}
@@ -0,0 +1,127 @@
+/**
+ * @file test_live_migration.cpp
+ * @brief Unit Tests for Live Migration
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include "../include/redcomponent/offloading/LiveMigration.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr size_t kPageSize = 4096;
+constexpr size_t kPages = 1000;
+
+/**
+ * @brief Shard whose writers run while pages are copied (virtual time)
+ */
+struct SimulatedShard {
+    ChangeTracker tracker{kPages * kPageSize, kPageSize};
+    LiveMigration::Clock::time_point now{};
+    size_t sends = 0;
+    size_t writes_every = 10;       // One write per this many page copies
+    size_t hot_pages = 20;          // Writes cycle over this many pages (0 = always new pages)
+    size_t next_write = 0;
+    bool paused = false;
+    size_t writes_while_paused = 0;
+    size_t pauses = 0;
+    size_t resumes = 0;
+    bool accept_cutover = true;
+
+    void write() {
+        if (paused) {
+            writes_while_paused++;
+            return;
+        }
+        size_t page = hot_pages > 0 ? next_write++ % hot_pages : next_write++ % kPages;
+        tracker.record_write(page * kPageSize, 8);
+    }
+
+    LiveMigrationHandlers handlers() {
+        LiveMigrationHandlers h;
+        h.send_page = [this](size_t, uint64_t, size_t) {
+            now += 1ms;
+            if (++sends % writes_every == 0) write();
+            return true;
+        };
+        h.pause_writes = [this] { paused = true; pauses++; };
+        h.resume_writes = [this] { paused = false; resumes++; };
+        h.cutover = [this] { return accept_cutover; };
+        return h;
+    }
+
+    LiveMigration migration(LiveMigrationOptions options) {
+        return LiveMigration(tracker, "node1", options, handlers(), [this] { return now; });
+    }
+};
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Live Migration Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(LiveMigrationTest, ConvergesInShrinkingRoundsWithBriefPause) {
+    SimulatedShard shard;
+    LiveMigrationOptions options;
+    options.max_write_pause = 10ms;
+    auto result = shard.migration(options).run();
+
+    ASSERT_TRUE(result.success) << result.error_message.value_or("");
+    ASSERT_EQ(result.rounds.size(), 2u);
+    EXPECT_EQ(result.rounds[0].pages, kPages);          // Bulk copy
+    EXPECT_EQ(result.rounds[1].pages, 20u);             // Hot set dirtied during bulk copy
+    EXPECT_EQ(result.final_round.pages, 2u);
+    EXPECT_EQ(result.write_pause, 2ms);
+    EXPECT_EQ(shard.pauses, 1u);
+    EXPECT_EQ(shard.resumes, 1u);
+    EXPECT_EQ(shard.writes_while_paused, 0u);
+    EXPECT_TRUE(shard.tracker.plan("node1").empty());
+    EXPECT_EQ(result.total_bytes_sent, (kPages + 22) * kPageSize);
+}
+
+TEST(LiveMigrationTest, AbortsWhenWritesOutpaceCopy) {
+    SimulatedShard shard;
+    shard.writes_every = 1;
+    shard.hot_pages = 0;                                // Every copy dirties another page
+    LiveMigrationOptions options;
+    options.max_write_pause = 1ms;
+    auto result = shard.migration(options).run();
+
+    EXPECT_FALSE(result.success);
+    ASSERT_TRUE(result.error_message.has_value());
+    EXPECT_EQ(result.rounds.size(), 1u);
+    EXPECT_EQ(shard.pauses, 0u);                        // Never stopped the shard
+}
+
+TEST(LiveMigrationTest, ForcedCutoverCopiesRemainingPages) {
+    SimulatedShard shard;
+    shard.writes_every = 1;
+    shard.hot_pages = 0;
+    LiveMigrationOptions options;
+    options.max_write_pause = 1ms;
+    options.force_cutover = true;
+    auto result = shard.migration(options).run();
+
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(result.final_round.pages, kPages);
+    EXPECT_EQ(shard.resumes, 1u);
+    EXPECT_TRUE(shard.tracker.plan("node1").empty());
+}
+
+TEST(LiveMigrationTest, RejectedCutoverResumesWrites) {
+    SimulatedShard shard;
+    shard.accept_cutover = false;
+    auto result = shard.migration({}).run();
+
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(result.error_message, "Cutover rejected by target");
+    EXPECT_EQ(shard.pauses, 1u);
+    EXPECT_EQ(shard.resumes, 1u);
+}
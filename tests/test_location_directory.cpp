@@ -0,0 +1,120 @@
+/**
+ * @file test_location_directory.cpp
+ * @brief Unit Tests for the Offloaded-Data Location Directory
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Directory Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(LocationDirectoryTest, RecordsLatestOwner) {
+    LocationDirectory directory;
+    EXPECT_FALSE(directory.lookup("orders").has_value());
+
+    directory.record("orders", "node1");
+    directory.record("users", "node2");
+    EXPECT_EQ(*directory.lookup("orders"), "node1");
+
+    directory.record("orders", "node3");        // Migrated
+    EXPECT_EQ(*directory.lookup("orders"), "node3");
+    EXPECT_EQ(directory.size(), 2u);
+
+    EXPECT_TRUE(directory.erase("users"));
+    EXPECT_FALSE(directory.erase("users"));
+    directory.record("events", "node3");
+    EXPECT_EQ(directory.erase_node("node3"), 2u);
+    EXPECT_EQ(directory.size(), 0u);
+}
+
+TEST(LocationDirectoryTest, SnapshotRoundTripsAndRejectsCorruption) {
+    LocationDirectory directory;
+    for (int i = 0; i < 1000; ++i) {
+        directory.record("data-" + std::to_string(i), "node" + std::to_string(i % 7));
+    }
+    auto image = directory.serialize();
+
+    LocationDirectory restored;
+    ASSERT_TRUE(restored.deserialize(image));
+    EXPECT_EQ(restored.size(), 1000u);
+    EXPECT_EQ(*restored.lookup("data-123"), "node4");
+
+    auto corrupt = image;
+    corrupt[corrupt.size() / 2] ^= std::byte{0x01};
+    EXPECT_FALSE(restored.deserialize(corrupt));
+    EXPECT_FALSE(restored.deserialize(std::span(image).first(image.size() - 10)));
+    EXPECT_EQ(restored.size(), 1000u);          // Unchanged on failure
+
+    auto path = std::filesystem::temp_directory_path() / "redcomponent_location_test.bin";
+    ASSERT_TRUE(directory.save(path));
+    LocationDirectory loaded;
+    ASSERT_TRUE(loaded.load(path));
+    EXPECT_EQ(*loaded.lookup("data-999"), "node5");
+    std::filesystem::remove(path);
+}
+
+TEST(LocationDirectoryTest, ConcurrentRecordsAndFastLookups) {
+    LocationDirectory directory;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&directory, t] {
+            for (int i = 0; i < 25000; ++i) {
+                directory.record("data-" + std::to_string(t * 25000 + i), "node" + std::to_string(t));
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    ASSERT_EQ(directory.size(), 100000u);
+
+    std::vector<std::string> keys;
+    for (int i = 0; i < 100000; i += 7) {
+        keys.push_back("data-" + std::to_string(i));
+    }
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < 10; ++round) {
+        for (const auto& key : keys) {
+            found += directory.lookup(key).has_value();
+        }
+    }
+    auto per_lookup = (std::chrono::steady_clock::now() - start) / (keys.size() * 10);
+    EXPECT_EQ(found, keys.size() * 10);
+    // Well under a microsecond even unoptimized; generous bound for loaded CI hosts
+    EXPECT_LT(per_lookup, std::chrono::microseconds(2));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Manager Integration Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(LocationDirectoryTest, ManagerRecordsOnSuccessfulCompletion) {
+    MockOffloadManager manager;
+    auto directory = std::make_shared<LocationDirectory>();
+    manager.set_location_directory(directory);
+
+    ASSERT_TRUE(manager.select_target_node("node2"));
+    ASSERT_TRUE(manager.start_offload({"orders", "users"}));
+    manager.simulate_complete(true);
+    EXPECT_EQ(*directory->lookup("orders"), "node2");
+    EXPECT_EQ(*directory->lookup("users"), "node2");
+
+    manager.force_status(OffloadStatus::Idle);
+    ASSERT_TRUE(manager.select_target_node("node1"));
+    ASSERT_TRUE(manager.start_offload({"orders"}));
+    manager.simulate_complete(false);
+    EXPECT_EQ(*directory->lookup("orders"), "node2");     // Failed offload moves nothing
+}
@@ -0,0 +1,151 @@
+/**
+ * @file test_metrics.cpp
+ * @brief Unit Tests for Offload Metrics
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "../include/redcomponent/offloading/LatencyHistogram.hpp"
+#include "../include/redcomponent/offloading/MetricsRegistry.hpp"
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Latency Histogram Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(LatencyHistogramTest, BucketBoundsAreConsistent) {
+    for (uint64_t v : {0ULL, 1ULL, 63ULL, 64ULL, 65ULL, 1000ULL, 123456ULL, 1ULL << 39}) {
+        size_t idx = LatencyHistogram::bucket_index(v);
+        ASSERT_LT(idx, LatencyHistogram::kBucketCount);
+        EXPECT_GE(LatencyHistogram::bucket_upper_bound(idx), v);
+        if (idx > 0) {
+            EXPECT_LT(LatencyHistogram::bucket_upper_bound(idx - 1), v);
+        }
+    }
+    EXPECT_EQ(LatencyHistogram::bucket_index(LatencyHistogram::kMaxTrackableUs),
+              LatencyHistogram::kBucketCount - 1);
+}
+
+TEST(LatencyHistogramTest, PercentilesWithinPrecision) {
+    LatencyHistogram histogram;
+    for (int i = 1; i <= 1000; ++i) {
+        histogram.record(std::chrono::microseconds{i * 10});
+    }
+
+    auto snap = histogram.snapshot();
+    EXPECT_EQ(snap.count, 1000u);
+    EXPECT_EQ(snap.min_us, 10u);
+    EXPECT_EQ(snap.max_us, 10000u);
+    EXPECT_NEAR(snap.percentile(50).count(), 5000, 5000 * 0.04);
+    EXPECT_NEAR(snap.percentile(99).count(), 9900, 9900 * 0.04);
+    EXPECT_EQ(snap.percentile(100).count(), 10000);
+    EXPECT_EQ(snap.mean().count(), 5005);
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecording) {
+    LatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&histogram, t]() {
+            for (int i = 0; i < 10000; ++i) {
+                histogram.record(std::chrono::microseconds{100 + t});
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto snap = histogram.snapshot();
+    EXPECT_EQ(snap.count, 80000u);
+    EXPECT_EQ(snap.min_us, 100u);
+    EXPECT_EQ(snap.max_us, 107u);
+}
+
+TEST(LatencyHistogramTest, MockExposesPerNodeTailLatency) {
+    MockOffloadManager manager;
+    ASSERT_TRUE(manager.select_target_node("node1"));
+    for (int i = 0; i < 99; ++i) {
+        manager.simulate_segment_timing(2ms, 100us, 300us);
+    }
+    manager.simulate_segment_timing(250ms, 100us, 300us);
+
+    ASSERT_TRUE(manager.select_target_node("node2"));
+    for (int i = 0; i < 100; ++i) {
+        manager.simulate_segment_timing(2ms, 100us, 300us);
+    }
+
+    auto snapshot = manager.get_metrics_snapshot();
+    EXPECT_EQ(snapshot.segments.transfer.count, 200u);
+    ASSERT_EQ(snapshot.per_node.size(), 2u);
+    EXPECT_GE(snapshot.per_node["node1"].transfer.percentile(99.9), 240ms);
+    EXPECT_LE(snapshot.per_node["node2"].transfer.percentile(99.9), 3ms);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// OpenMetrics Exporter Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(MetricsRegistryTest, RendersOpenMetricsText) {
+    MetricsRegistry registry;
+    auto& requests = registry.counter("demo_requests", "Requests handled");
+    auto& temp = registry.gauge("demo_temperature", "Temperature", {{"room", "a\"b"}});
+    requests.inc(3);
+    temp.set(21.5);
+
+    // Same name and labels resolve to the same series
+    EXPECT_EQ(&registry.counter("demo_requests", "Requests handled"), &requests);
+
+    EXPECT_EQ(registry.render_openmetrics(),
+              "# TYPE demo_requests counter\n"
+              "# HELP demo_requests Requests handled\n"
+              "demo_requests_total 3\n"
+              "# TYPE demo_temperature gauge\n"
+              "# HELP demo_temperature Temperature\n"
+              "demo_temperature{room=\"a\\\"b\"} 21.5\n"
+              "# EOF\n");
+}
+
+TEST(MetricsRegistryTest, ServesScrapeRequests) {
+    MetricsRegistry registry;
+    registry.counter("demo_requests", "Requests handled").inc();
+
+    auto ok = registry.handle_http_request("GET /metrics HTTP/1.1");
+    EXPECT_EQ(ok.rfind("HTTP/1.1 200 OK", 0), 0u);
+    EXPECT_NE(ok.find("application/openmetrics-text"), std::string::npos);
+    EXPECT_NE(ok.find("demo_requests_total 1\n# EOF\n"), std::string::npos);
+
+    auto missing = registry.handle_http_request("GET /metricsx HTTP/1.1");
+    EXPECT_EQ(missing.rfind("HTTP/1.1 404", 0), 0u);
+}
+
+TEST(MetricsRegistryTest, MockPublishesOffloadMetrics) {
+    MockOffloadManager manager;
+    ASSERT_TRUE(manager.select_target_node("node1"));
+    ASSERT_TRUE(manager.start_offload());
+    manager.simulate_progress(1024);
+    manager.simulate_progress(2048);
+    manager.simulate_segment_retry();
+    manager.refresh_nodes();
+    manager.simulate_complete(true);
+
+    const auto& metrics = manager.metrics();
+    EXPECT_EQ(metrics.bytes_transferred.value(), 3072u);
+    EXPECT_EQ(metrics.segment_retries.value(), 1u);
+    EXPECT_EQ(metrics.offloads_started.value(), 1u);
+    EXPECT_EQ(metrics.offloads_succeeded.value(), 1u);
+    EXPECT_EQ(metrics.segments_completed.value(), 100.0);
+
+    auto text = metrics.registry().render_openmetrics();
+    EXPECT_NE(text.find("redcomponent_offload_operations_total{result=\"success\"} 1\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("redcomponent_offload_node_active_offloads{node_id=\"node2\"} 0\n"),
+              std::string::npos);
+}
@@ -0,0 +1,156 @@
+/**
+ * @file test_pipeline.cpp
+ * @brief Unit Tests for CRC32C and the Segment Pipeline
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string_view>
+#include <thread>
+
+#include "../include/redcomponent/offloading/SegmentPipeline.hpp"
+
+using namespace redcomponent::offloading;
+
+namespace {
+
+std::span<const std::byte> as_bytes(std::string_view s) {
+    return std::as_bytes(std::span<const char>(s.data(), s.size()));
+}
+
+// Reads @p count segments of @p size bytes filled with the segment id
+std::function<bool(PipelineSegment&)> counting_reader(size_t count, size_t size) {
+    auto next = std::make_shared<size_t>(0);
+    return [next, count, size](PipelineSegment& s) {
+        if (*next >= count) return false;
+        s.offset = *next * size;
+        s.buffer.resize(size);
+        std::memset(s.buffer.data(), static_cast<int>(*next & 0xFF), size);
+        ++*next;
+        return true;
+    };
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Checksum Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(Crc32cTest, KnownVectorsAndIncremental) {
+    EXPECT_EQ(crc32c(as_bytes("")), 0u);
+    EXPECT_EQ(crc32c(as_bytes("123456789")), 0xE3069283u);
+
+    std::string_view text = "The quick brown fox jumps over the lazy dog";
+    uint32_t whole = crc32c(as_bytes(text));
+    uint32_t split = crc32c(as_bytes(text.substr(11)), crc32c(as_bytes(text.substr(0, 11))));
+    EXPECT_EQ(whole, split);
+    EXPECT_EQ(whole, 0x22620404u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Pipeline Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(SegmentPipelineTest, ProcessesAllSegmentsInOrder) {
+    SegmentBufferPool pool(4, 4096, {-1, false, false});
+    std::vector<uint64_t> sent;
+    std::vector<uint32_t> checksums;
+
+    PipelineHandlers handlers;
+    handlers.read = counting_reader(20, 1000);
+    handlers.send = [&](PipelineSegment& s) {
+        sent.push_back(s.segment_id);
+        checksums.push_back(s.checksum);
+        return true;
+    };
+    handlers.ack = [](PipelineSegment&) { return true; };
+
+    SegmentPipeline pipeline(pool, handlers);
+    auto result = pipeline.run();
+
+    EXPECT_EQ(result.segments_completed, 20u);
+    EXPECT_EQ(result.segments_failed, 0u);
+    EXPECT_EQ(result.bytes_completed, 20000u);
+    ASSERT_EQ(sent.size(), 20u);
+    for (uint64_t i = 0; i < sent.size(); ++i) {
+        EXPECT_EQ(sent[i], i);
+    }
+    std::vector<std::byte> expected(1000, std::byte{3});
+    EXPECT_EQ(checksums[3], crc32c(expected));
+    EXPECT_EQ(pool.available(), pool.capacity());
+    EXPECT_EQ(result.stages[static_cast<size_t>(PipelineStage::Checksum)].segments, 20u);
+}
+
+TEST(SegmentPipelineTest, FailedSegmentsAreReportedAndRecycled) {
+    SegmentBufferPool pool(2, 4096, {-1, false, false});
+    PipelineHandlers handlers;
+    handlers.read = counting_reader(10, 100);
+    handlers.compress = [](PipelineSegment& s) {
+        s.compressed = true;
+        return s.segment_id != 4;
+    };
+    handlers.send = [](PipelineSegment& s) { return s.compressed; };
+    handlers.ack = [](PipelineSegment& s) { return s.segment_id != 7; };
+
+    SegmentPipeline pipeline(pool, handlers);
+    auto result = pipeline.run();
+
+    EXPECT_EQ(result.segments_completed, 8u);
+    EXPECT_EQ(result.segments_failed, 2u);
+    EXPECT_EQ(result.failed_segment_ids, (std::vector<uint64_t>{4, 7}));
+    EXPECT_EQ(pool.available(), pool.capacity());
+}
+
+TEST(SegmentPipelineTest, BackpressureBoundsSegmentsInFlight) {
+    SegmentBufferPool pool(3, 4096, {-1, false, false});
+    std::atomic<int> in_flight{0};
+    std::atomic<int> peak{0};
+
+    PipelineHandlers handlers;
+    auto reader = counting_reader(30, 512);
+    handlers.read = [&](PipelineSegment& s) {
+        if (!reader(s)) return false;
+        int now = ++in_flight;
+        int prev = peak.load();
+        while (now > prev && !peak.compare_exchange_weak(prev, now)) {}
+        return true;
+    };
+    handlers.send = [](PipelineSegment&) { return true; };
+    handlers.ack = [&](PipelineSegment&) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        --in_flight;
+        return true;
+    };
+
+    SegmentPipeline pipeline(pool, handlers, 8);
+    auto result = pipeline.run();
+
+    EXPECT_EQ(result.segments_completed, 30u);
+    EXPECT_LE(peak.load(), 3);      // Never more than the pool's slabs
+    EXPECT_GT(result.stages[static_cast<size_t>(PipelineStage::Read)].blocked.count(), 0);
+}
+
+TEST(SegmentPipelineTest, SlowStageIsReportedAsBottleneck) {
+    SegmentBufferPool pool(4, 4096, {-1, false, false});
+    PipelineHandlers handlers;
+    handlers.read = counting_reader(10, 4096);
+    handlers.send = [](PipelineSegment&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return true;
+    };
+    handlers.ack = [](PipelineSegment&) { return true; };
+
+    SegmentPipeline pipeline(pool, handlers);
+    auto result = pipeline.run();
+
+    EXPECT_EQ(result.bottleneck(), PipelineStage::Send);
+    const auto& send = result.stages[static_cast<size_t>(PipelineStage::Send)];
+    const auto& checksum = result.stages[static_cast<size_t>(PipelineStage::Checksum)];
+    EXPECT_LT(send.capacity_bytes_per_second(), checksum.capacity_bytes_per_second());
+    EXPECT_GT(result.bytes_per_second(), 0.0);
+}
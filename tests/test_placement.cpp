@@ -0,0 +1,141 @@
+/**
+ * @file test_placement.cpp
+ * @brief Unit Tests for Offload Placement (Striping and Planning)
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+
+#include "../include/redcomponent/offloading/StripePlanner.hpp"
+#include "../include/redcomponent/offloading/OffloadPlanner.hpp"
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+
+namespace {
+
+constexpr size_t MB = 1024 * 1024;
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Stripe Planner Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(StripePlannerTest, ProportionalToSpareBandwidth) {
+    std::vector<TargetNode> nodes = {
+        MockOffloadManager::create_mock_node("fast", "10.0.0.1", 1000 * MB),
+        MockOffloadManager::create_mock_node("slow", "10.0.0.2", 1000 * MB),
+    };
+    auto plan = StripePlanner::plan(nodes, {3.0e8, 1.0e8}, 100 * MB, MB);
+
+    ASSERT_TRUE(plan.complete());
+    EXPECT_EQ(plan.targets[0].segment_count, 75u);
+    EXPECT_EQ(plan.targets[1].segment_count, 25u);
+    EXPECT_EQ(plan.targets[0].bytes + plan.targets[1].bytes, 100 * MB);
+
+    // Smooth round-robin never gives the slow node two segments in a row
+    for (size_t s = 1; s < plan.segment_targets.size(); ++s) {
+        EXPECT_FALSE(plan.segment_targets[s] == 1 && plan.segment_targets[s - 1] == 1);
+    }
+}
+
+TEST(StripePlannerTest, StorageCapShiftsLoad) {
+    std::vector<TargetNode> nodes = {
+        MockOffloadManager::create_mock_node("small", "10.0.0.1", 10 * MB),
+        MockOffloadManager::create_mock_node("large", "10.0.0.2", 1000 * MB),
+    };
+    auto plan = StripePlanner::plan(nodes, {1.0e9, 1.0e8}, 100 * MB, MB);
+
+    ASSERT_TRUE(plan.complete());
+    EXPECT_EQ(plan.targets[0].bytes, 10 * MB);
+    EXPECT_EQ(plan.targets[1].bytes, 90 * MB);
+}
+
+TEST(StripePlannerTest, ReportsUnassignedSegments) {
+    std::vector<TargetNode> nodes = {
+        MockOffloadManager::create_mock_node("tiny", "10.0.0.1", 5 * MB),
+    };
+    auto plan = StripePlanner::plan(nodes, {1.0e8}, 8 * MB, MB);
+
+    EXPECT_FALSE(plan.complete());
+    EXPECT_EQ(plan.unassigned_segments, 3u);
+}
+
+TEST(StripePlannerTest, MockStripesAcrossEligibleNodes) {
+    MockOffloadManager manager;
+    OffloadConfig config;
+    config.max_stripe_targets = 3;
+    manager.set_config(config);
+    manager.set_node_health("node3", NodeHealth::Unhealthy);
+
+    ASSERT_TRUE(manager.select_target_node("node1"));
+    ASSERT_TRUE(manager.start_offload());
+
+    auto plan = manager.get_stripe_plan();
+    ASSERT_TRUE(plan.complete());
+    ASSERT_EQ(plan.targets.size(), 2u);
+    EXPECT_EQ(plan.targets[0].node_id, "node1");
+    EXPECT_EQ(plan.targets[1].node_id, "node2");
+    EXPECT_EQ(plan.segment_targets.size(), manager.get_progress().segments_total);
+}
+
+TEST(StripePlannerTest, MockDoesNotStripeByDefault) {
+    MockOffloadManager manager;
+    ASSERT_TRUE(manager.select_target_node("node1"));
+    ASSERT_TRUE(manager.start_offload());
+    EXPECT_TRUE(manager.get_stripe_plan().targets.empty());
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Offload Planner Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(OffloadPlannerTest, BalancesMakespanAcrossNodes) {
+    auto a = MockOffloadManager::create_mock_node("a", "10.0.0.1", 10000 * MB);
+    auto b = MockOffloadManager::create_mock_node("b", "10.0.0.2", 10000 * MB);
+    a.max_concurrent_offloads = 1;
+    b.max_concurrent_offloads = 1;
+
+    std::vector<DataItem> items = {
+        {"s1", 700 * MB}, {"s2", 500 * MB}, {"s3", 400 * MB},
+        {"s4", 300 * MB}, {"s5", 100 * MB},
+    };
+    auto plan = OffloadPlanner::plan(items, {a, b}, {100.0 * MB, 100.0 * MB});
+
+    ASSERT_TRUE(plan.complete());
+    EXPECT_EQ(plan.placements.size(), items.size());
+    // Total 2000MB over 2 x 100MB/s: optimal makespan is 10s
+    EXPECT_NEAR(plan.makespan_seconds, 10.0, 1e-9);
+    EXPECT_EQ(plan.data_ids_for("a").front(), "s1");
+}
+
+TEST(OffloadPlannerTest, RespectsStorageAndSlots) {
+    auto small = MockOffloadManager::create_mock_node("small", "10.0.0.1", 150 * MB);
+    auto busy = MockOffloadManager::create_mock_node("busy", "10.0.0.2", 10000 * MB);
+    busy.max_concurrent_offloads = 3;
+    busy.active_offload_count = 2;
+
+    std::vector<DataItem> items = {{"big", 200 * MB}, {"m1", 100 * MB}, {"m2", 100 * MB}};
+    auto plan = OffloadPlanner::plan(items, {small, busy}, {1000.0 * MB, 100.0 * MB});
+
+    ASSERT_TRUE(plan.complete());
+    size_t on_small = 0;
+    for (const auto& p : plan.placements) {
+        if (p.node_id == "small") on_small += p.size_bytes;
+    }
+    EXPECT_LE(on_small, 150 * MB);
+    EXPECT_EQ(plan.data_ids_for("busy").size(), 2u);
+    EXPECT_EQ(plan.rounds, 2u);
+}
+
+TEST(OffloadPlannerTest, ReportsUnplacedItems) {
+    MockOffloadManager manager;
+    auto plan = manager.plan_offload({{"huge", 1ULL << 50}, {"ok", MB}});
+
+    EXPECT_FALSE(plan.complete());
+    ASSERT_EQ(plan.unplaced.size(), 1u);
+    EXPECT_EQ(plan.unplaced[0].data_id, "huge");
+    EXPECT_EQ(plan.placements.size(), 1u);
+}
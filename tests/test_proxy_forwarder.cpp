@@ -0,0 +1,161 @@
+/**
+ * @file test_proxy_forwarder.cpp
+ * @brief Unit Tests for Batched, Pipelined Proxy Forwarding
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../include/redcomponent/offloading/ProxyForwarder.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+namespace {
+
+std::span<const std::byte> as_bytes(const std::string& s) {
+    return std::as_bytes(std::span<const char>(s.data(), s.size()));
+}
+
+std::string as_string(std::span<const std::byte> bytes) {
+    return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+}
+
+// Target that answers "<data_id>:<body>", or NotFound for ids starting with "missing"
+ForwardReply echo(std::string_view data_id, std::span<const std::byte> body) {
+    if (data_id.starts_with("missing")) return {ForwardStatus::NotFound, {}};
+    std::string reply = std::string(data_id) + ":" + as_string(body);
+    auto bytes = as_bytes(reply);
+    return {ForwardStatus::Ok, {bytes.begin(), bytes.end()}};
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Batching Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ProxyForwarderTest, BatchesRequestsAndMatchesResponses) {
+    ProxyForwarder* self = nullptr;
+    size_t writes = 0;
+    ProxyForwarder forwarder([&](std::span<const std::byte> frame) {
+        writes++;
+        auto response = serve_forward_batch(frame, echo);
+        return self->on_response(response).has_value();
+    });
+    self = &forwarder;
+
+    std::map<std::string, std::string> replies;
+    size_t not_found = 0;
+    for (int i = 0; i < 200; ++i) {
+        std::string id = (i % 50 == 0 ? "missing-" : "key-") + std::to_string(i);
+        forwarder.forward(id, as_bytes("get"), [&, id](ForwardStatus status, std::span<const std::byte> body) {
+            if (status == ForwardStatus::NotFound) not_found++;
+            else replies[id] = as_string(body);
+        });
+    }
+    EXPECT_EQ(writes, 3u);                  // 3 full batches of 64
+    EXPECT_EQ(forwarder.pending(), 8u);
+    forwarder.flush();
+
+    EXPECT_EQ(writes, 4u);
+    EXPECT_EQ(replies.size(), 196u);
+    EXPECT_EQ(not_found, 4u);
+    EXPECT_EQ(replies["key-7"], "key-7:get");
+    EXPECT_EQ(forwarder.in_flight(), 0u);
+    EXPECT_EQ(forwarder.stats().requests_per_batch(), 50.0);
+}
+
+TEST(ProxyForwarderTest, PipelinesBatchesAndAcceptsOutOfOrderResponses) {
+    std::vector<std::vector<std::byte>> wire;
+    ProxyForwarderOptions options;
+    options.max_batch_requests = 100;
+    ProxyForwarder forwarder([&](std::span<const std::byte> frame) {
+        wire.emplace_back(frame.begin(), frame.end());
+        return true;
+    }, options);
+
+    std::vector<std::string> completed;
+    for (int i = 0; i < 1000; ++i) {
+        std::string id = "key-" + std::to_string(i);
+        forwarder.forward(id, {}, [&completed, id](ForwardStatus status, std::span<const std::byte>) {
+            if (status == ForwardStatus::Ok) completed.push_back(id);
+        });
+    }
+    // All ten batches are on the wire before the first response: one round trip total
+    EXPECT_EQ(wire.size(), 10u);
+    EXPECT_EQ(forwarder.in_flight(), 1000u);
+
+    for (auto it = wire.rbegin(); it != wire.rend(); ++it) {
+        ASSERT_EQ(forwarder.on_response(serve_forward_batch(*it, echo)), 100u);
+    }
+    EXPECT_EQ(completed.size(), 1000u);
+    EXPECT_EQ(completed.front(), "key-900");
+    EXPECT_EQ(forwarder.in_flight(), 0u);
+}
+
+TEST(ProxyForwarderTest, PollFlushesAfterBatchDelay) {
+    auto now = std::chrono::steady_clock::time_point{};
+    size_t writes = 0;
+    ProxyForwarderOptions options;
+    options.max_batch_delay = 50us;
+    ProxyForwarder forwarder([&](std::span<const std::byte>) { writes++; return true; },
+                             options, [&] { return now; });
+
+    for (int i = 0; i < 3; ++i) {
+        forwarder.forward("key", {}, nullptr);
+    }
+    now += 10us;
+    forwarder.poll();
+    EXPECT_EQ(writes, 0u);
+    now += 45us;
+    forwarder.poll();
+    EXPECT_EQ(writes, 1u);
+    EXPECT_EQ(forwarder.pending(), 0u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Failure Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ProxyForwarderTest, BackpressureAndConnectionLoss) {
+    bool link_up = true;
+    std::vector<std::vector<std::byte>> wire;
+    ProxyForwarderOptions options;
+    options.max_batch_requests = 2;
+    options.max_in_flight = 4;
+    ProxyForwarder forwarder([&](std::span<const std::byte> frame) {
+        wire.emplace_back(frame.begin(), frame.end());
+        return link_up;
+    }, options);
+
+    size_t lost = 0;
+    auto count_lost = [&](ForwardStatus status, std::span<const std::byte>) {
+        if (status == ForwardStatus::ConnectionLost) lost++;
+    };
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(forwarder.forward("key", {}, count_lost).has_value());
+    }
+    EXPECT_FALSE(forwarder.forward("key", {}, count_lost).has_value());
+    EXPECT_EQ(forwarder.stats().rejected, 1u);
+
+    forwarder.fail_in_flight();             // Connection dropped
+    EXPECT_EQ(lost, 4u);
+    EXPECT_EQ(forwarder.on_response(serve_forward_batch(wire.front(), echo)), 0u);  // Too late
+
+    link_up = false;
+    forwarder.forward("key", {}, count_lost);
+    forwarder.forward("key", {}, count_lost);
+    EXPECT_EQ(lost, 6u);
+    EXPECT_EQ(forwarder.in_flight(), 0u);
+
+    auto corrupt = serve_forward_batch(wire.front(), echo);
+    corrupt.back() ^= std::byte{0x01};
+    EXPECT_FALSE(forwarder.on_response(corrupt).has_value());
+    EXPECT_TRUE(serve_forward_batch(corrupt, echo).empty());
+}
@@ -0,0 +1,90 @@
+/**
+ * @file test_rate_estimator.cpp
+ * @brief Unit Tests for Transfer Rate Estimation
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+
+#include "../include/redcomponent/offloading/RateEstimator.hpp"
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr size_t MB = 1024 * 1024;
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Rate Estimator Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(RateEstimatorTest, SteadyRateWithinFirstSecond) {
+    RateEstimator estimator;
+    auto t0 = RateEstimator::Clock::time_point{} + 1h;
+    estimator.start(t0);
+
+    // 1MB every 10ms = 100MB/s
+    for (int i = 1; i <= 20; ++i) {
+        estimator.record(MB, t0 + i * 10ms);
+    }
+
+    EXPECT_NEAR(estimator.average_rate(), 100.0 * MB, 1.0);
+    EXPECT_NEAR(estimator.window_rate(), 100.0 * MB, 1.0);
+    EXPECT_NEAR(estimator.ewma_rate(), 100.0 * MB, 1.0);
+}
+
+TEST(RateEstimatorTest, WindowTracksRecentRate) {
+    RateEstimator estimator{250ms};
+    auto t0 = RateEstimator::Clock::time_point{} + 1h;
+    estimator.start(t0);
+
+    auto t = t0;
+    for (size_t i = 0; i < RateEstimator::kWindowSize * 2; ++i) {
+        t += 10ms;
+        estimator.record(MB, t);            // 100MB/s
+    }
+    for (size_t i = 0; i < RateEstimator::kWindowSize; ++i) {
+        t += 20ms;
+        estimator.record(MB, t);            // 50MB/s
+    }
+
+    EXPECT_EQ(estimator.window_samples(), RateEstimator::kWindowSize);
+    EXPECT_NEAR(estimator.window_rate(), 50.0 * MB, 1.0);
+    EXPECT_GT(estimator.average_rate(), 50.0 * MB);
+    // EWMA has decayed most of the way towards the new rate
+    EXPECT_LT(estimator.ewma_rate(), 60.0 * MB);
+}
+
+TEST(RateEstimatorTest, SameMicrosecondSamplesAreFolded) {
+    RateEstimator estimator;
+    auto t0 = RateEstimator::Clock::time_point{} + 1h;
+    estimator.start(t0);
+
+    estimator.record(MB, t0);
+    estimator.record(MB, t0 + 10ms);
+
+    EXPECT_EQ(estimator.total_bytes(), 2 * MB);
+    EXPECT_NEAR(estimator.window_rate(), 200.0 * MB, 1.0);
+}
+
+TEST(RateEstimatorTest, MockEtaIsStableBeforeFirstSecond) {
+    MockOffloadManager manager;
+    ASSERT_TRUE(manager.select_target_node("node1"));
+    ASSERT_TRUE(manager.start_offload());
+
+    auto start = manager.get_progress().start_time;
+    for (int i = 1; i <= 10; ++i) {
+        manager.simulate_progress(MB, start + i * 10ms);
+    }
+
+    auto progress = manager.get_progress();
+    EXPECT_NEAR(progress.smoothed_bytes_per_second, 100.0 * MB, 1.0);
+    EXPECT_NEAR(progress.bytes_per_second, 100.0 * MB, 1.0);
+    // 90MB pending at 100MB/s rounds up to one second
+    EXPECT_EQ(progress.estimated_time_remaining(), 1s);
+}
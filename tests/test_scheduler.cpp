@@ -0,0 +1,107 @@
+/**
+ * @file test_scheduler.cpp
+ * @brief Unit Tests for Priority Classes and the Segment Scheduler
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+
+#include "../include/redcomponent/offloading/SegmentScheduler.hpp"
+
+using namespace redcomponent::offloading;
+
+namespace {
+
+constexpr size_t kSegment = 1024 * 1024;
+
+std::map<uint64_t, size_t> drain(SegmentScheduler& scheduler, size_t count) {
+    std::map<uint64_t, size_t> served;
+    for (size_t i = 0; i < count; ++i) {
+        auto segment = scheduler.next();
+        if (!segment) break;
+        served[segment->job_id]++;
+    }
+    return served;
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Priority Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(OffloadPriorityTest, ClassifiesThresholdBreaches) {
+    OffloadConfig config;
+    EXPECT_EQ(priority_for({50.0, 90.0}, config), OffloadPriority::Emergency);
+    EXPECT_EQ(priority_for({85.0, 50.0}, config), OffloadPriority::High);
+    EXPECT_EQ(priority_for({50.0, 50.0}, config), OffloadPriority::Background);
+    EXPECT_EQ(to_string(OffloadPriority::Emergency), "Emergency");
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Scheduler Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(SegmentSchedulerTest, SharesBandwidthByClassWeight) {
+    SegmentScheduler scheduler;
+    auto emergency = scheduler.add_job(OffloadPriority::Emergency, 10000, kSegment);
+    auto background = scheduler.add_job(OffloadPriority::Background, 10000, kSegment);
+
+    auto served = drain(scheduler, 650);
+    EXPECT_NEAR(static_cast<double>(served[emergency]), 640.0, 2.0);
+    EXPECT_NEAR(static_cast<double>(served[background]), 10.0, 2.0);    // Not starved
+    EXPECT_EQ(scheduler.bytes_scheduled(emergency), served[emergency] * kSegment);
+}
+
+TEST(SegmentSchedulerTest, LateEmergencyPreemptsBackgroundImmediately) {
+    SegmentScheduler scheduler;
+    auto background = scheduler.add_job(OffloadPriority::Background, 1000, kSegment);
+    drain(scheduler, 100);
+
+    auto emergency = scheduler.add_job(OffloadPriority::Emergency, 64, kSegment);
+    auto served = drain(scheduler, 65);
+    EXPECT_EQ(served[emergency], 64u);      // Done within 65 slots despite the backlog
+    EXPECT_EQ(served[background], 1u);
+    EXPECT_EQ(scheduler.pending_segments(emergency), 0u);
+}
+
+TEST(SegmentSchedulerTest, EqualClassesAlternateAndIdleJobsGainNoCredit) {
+    SegmentScheduler scheduler;
+    auto a = scheduler.add_job(OffloadPriority::Normal, 100, kSegment);
+    auto b = scheduler.add_job(OffloadPriority::Normal, 100, kSegment);
+    auto served = drain(scheduler, 20);
+    EXPECT_EQ(served[a], 10u);
+    EXPECT_EQ(served[b], 10u);
+
+    // A job joining late shares from now on rather than catching up
+    drain(scheduler, 100);
+    auto c = scheduler.add_job(OffloadPriority::Normal, 100, kSegment);
+    served = drain(scheduler, 30);
+    EXPECT_EQ(served[c], 10u);             // A third of the slots, no catch-up burst
+}
+
+TEST(SegmentSchedulerTest, RequeuedSegmentsAndEscalation) {
+    SegmentScheduler scheduler;
+    auto job = scheduler.add_job(OffloadPriority::Background, 3, kSegment);
+    auto other = scheduler.add_job(OffloadPriority::Background, 100, kSegment);
+
+    auto first = scheduler.next();
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first->job_id, job);
+    scheduler.requeue(*first);
+    EXPECT_EQ(scheduler.pending_segments(job), 3u);
+
+    EXPECT_TRUE(scheduler.set_priority(job, OffloadPriority::Emergency));
+    std::vector<size_t> order;
+    for (int i = 0; i < 4; ++i) {         // Three of the next four slots
+        auto s = scheduler.next();
+        ASSERT_TRUE(s);
+        if (s->job_id == job) order.push_back(s->segment_index);
+    }
+    EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2}));
+
+    EXPECT_TRUE(scheduler.remove_job(other));
+    EXPECT_TRUE(scheduler.empty());
+}
@@ -0,0 +1,139 @@
+/**
+ * @file test_segment_frame.cpp
+ * @brief Unit Tests for the Segment Wire Format
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../include/redcomponent/offloading/SegmentBufferPool.hpp"
+#include "../include/redcomponent/offloading/SegmentFrame.hpp"
+#include "../include/redcomponent/offloading/Transport.hpp"
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+
+namespace {
+
+std::vector<std::byte> make_payload(size_t size, uint8_t seed) {
+    std::vector<std::byte> payload(size);
+    for (size_t i = 0; i < size; ++i) {
+        payload[i] = static_cast<std::byte>((i * 13 + seed) & 0xFF);
+    }
+    return payload;
+}
+
+std::vector<std::byte> to_wire(const OutgoingFrame& frame) {
+    std::vector<std::byte> wire;
+    for (auto part : frame.gather()) {
+        wire.insert(wire.end(), part.begin(), part.end());
+    }
+    return wire;
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Encoding Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(SegmentFrameTest, RoundTripsWithoutCopyingPayload) {
+    SegmentBufferPool pool(1, 64 * 1024);
+    auto buffer = pool.try_acquire();
+    ASSERT_TRUE(buffer);
+    buffer.resize(5000);
+    auto payload = make_payload(5000, 3);
+    std::copy(payload.begin(), payload.end(), buffer.data());
+
+    auto frame = make_frame(42, 7 * 1024 * 1024, SegmentCodec::Compressed, buffer.bytes(),
+                            crc32c(buffer.bytes()));
+    EXPECT_EQ(frame.gather()[1].data(), buffer.data());     // Gathered straight from the slab
+    EXPECT_EQ(frame.size(), kSegmentFrameHeaderSize + 5000);
+
+    auto wire = to_wire(frame);
+    auto view = parse_frame(wire);
+    ASSERT_EQ(view.status, FrameParseStatus::Ok);
+    EXPECT_EQ(view.header.segment_id, 42u);
+    EXPECT_EQ(view.header.offset, 7u * 1024 * 1024);
+    EXPECT_EQ(view.header.length, 5000u);
+    EXPECT_EQ(view.header.codec, SegmentCodec::Compressed);
+    EXPECT_EQ(view.payload.data(), wire.data() + kSegmentFrameHeaderSize);   // Parsed in place
+    EXPECT_TRUE(view.payload_valid());
+    EXPECT_EQ(view.consumed, wire.size());
+}
+
+TEST(SegmentFrameTest, ParsesConsecutiveFramesFromPartialReads) {
+    auto a = make_payload(300, 1);
+    auto b = make_payload(700, 2);
+    auto stream = to_wire(make_frame(1, 0, SegmentCodec::None, a, crc32c(a)));
+    auto second = to_wire(make_frame(2, 300, SegmentCodec::None, b, crc32c(b)));
+    stream.insert(stream.end(), second.begin(), second.end());
+
+    auto partial = parse_frame(std::span(stream).first(10));
+    EXPECT_EQ(partial.status, FrameParseStatus::NeedMoreData);
+    partial = parse_frame(std::span(stream).first(100));
+    EXPECT_EQ(partial.status, FrameParseStatus::NeedMoreData);
+    EXPECT_EQ(partial.needed, kSegmentFrameHeaderSize + 300);
+
+    auto first = parse_frame(stream);
+    ASSERT_EQ(first.status, FrameParseStatus::Ok);
+    auto next = parse_frame(std::span(stream).subspan(first.consumed));
+    ASSERT_EQ(next.status, FrameParseStatus::Ok);
+    EXPECT_EQ(next.header.segment_id, 2u);
+    EXPECT_EQ(next.header.offset, 300u);
+    EXPECT_TRUE(next.payload_valid());
+}
+
+TEST(SegmentFrameTest, RejectsMalformedFrames) {
+    auto payload = make_payload(256, 9);
+    auto wire = to_wire(make_frame(5, 0, SegmentCodec::None, payload, crc32c(payload)));
+
+    auto bad = wire;
+    bad[0] ^= std::byte{0xFF};
+    EXPECT_EQ(parse_frame(bad).status, FrameParseStatus::BadMagic);
+    bad = wire;
+    bad[4] = std::byte{2};
+    EXPECT_EQ(parse_frame(bad).status, FrameParseStatus::UnsupportedVersion);
+    bad = wire;
+    bad[24] ^= std::byte{0x01};             // Length flipped: caught before trusting it
+    EXPECT_EQ(parse_frame(bad).status, FrameParseStatus::CorruptHeader);
+
+    SegmentFrameHeader header;
+    header.codec = static_cast<SegmentCodec>(9);
+    auto unknown = encode_frame_header(header);
+    EXPECT_EQ(parse_frame(unknown).status, FrameParseStatus::UnknownCodec);
+
+    bad = wire;
+    bad.back() ^= std::byte{0x01};
+    auto view = parse_frame(bad);
+    EXPECT_EQ(view.status, FrameParseStatus::Ok);
+    EXPECT_FALSE(view.payload_valid());
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Loopback Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(SegmentFrameTest, LoopbackSpeaksFramesWithNegligibleOverhead) {
+    LoopbackTarget target;
+    LoopbackTransport transport(target);
+    ASSERT_TRUE(transport.connect(MockOffloadManager::create_mock_node("t", "127.0.0.1", 1ULL << 30)));
+
+    auto payload = make_payload(1024 * 1024, 4);
+    for (uint64_t id = 0; id < 4; ++id) {
+        ASSERT_EQ(transport.send_segment(id, payload, crc32c(payload)), TransportStatus::Ok);
+    }
+    EXPECT_EQ(target.segment(3), payload);
+
+    double overhead = static_cast<double>(target.wire_bytes() - 4 * payload.size()) /
+                      static_cast<double>(4 * payload.size());
+    EXPECT_LT(overhead, 0.001);
+
+    auto wire = to_wire(make_frame(9, 0, SegmentCodec::None, payload, crc32c(payload)));
+    wire[kSegmentFrameHeaderSize] ^= std::byte{0x01};
+    EXPECT_EQ(target.receive_frame(wire), TransportStatus::ChecksumMismatch);
+    EXPECT_EQ(target.receive_frame(std::span(wire).first(100)), TransportStatus::ChecksumMismatch);
+    EXPECT_EQ(target.rejected_count(), 2u);
+}
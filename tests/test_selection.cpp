@@ -0,0 +1,109 @@
+/**
+ * @file test_selection.cpp
+ * @brief Unit Tests for Power-of-d-Choices Target Selection
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+
+namespace {
+
+std::vector<TargetNode> cluster(size_t count) {
+    std::vector<TargetNode> nodes;
+    for (size_t i = 0; i < count; ++i) {
+        // Slightly different free storage; node0 is the unique "best"
+        nodes.push_back(MockOffloadManager::create_mock_node(
+            "node" + std::to_string(i), "10.0.0." + std::to_string(i),
+            (200 - i) * 1024ULL * 1024 * 1024));
+    }
+    return nodes;
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Sampling Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(PowerOfChoicesTest, SamplesDistinctIndices) {
+    std::mt19937_64 rng(7);
+    for (int trial = 0; trial < 100; ++trial) {
+        auto picked = PowerOfChoices::sample(10, 4, rng);
+        std::set<size_t> distinct(picked.begin(), picked.end());
+        EXPECT_EQ(distinct.size(), 4u);
+        EXPECT_LT(*distinct.rbegin(), 10u);
+    }
+}
+
+TEST(PowerOfChoicesTest, FallsBackToScanWhenSamplesAreIneligible) {
+    std::mt19937_64 rng(1);
+    // Only index 97 is eligible; sampling 2 of 100 almost never finds it
+    auto best = PowerOfChoices::select(100, 2, rng,
+        [](size_t i) { return i == 97; },
+        [](size_t a, size_t b) { return a < b; });
+    ASSERT_TRUE(best.has_value());
+    EXPECT_EQ(*best, 97u);
+
+    EXPECT_FALSE(PowerOfChoices::select(100, 2, rng,
+        [](size_t) { return false; }, [](size_t, size_t) { return false; }));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Manager Selection Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(PowerOfChoicesSelectionTest, ConcurrentSelectionsSpreadOut) {
+    auto run = [](size_t choices) {
+        std::map<std::string, int> picks;
+        for (uint64_t source = 0; source < 200; ++source) {
+            MockOffloadManager manager;
+            manager.set_available_nodes(cluster(20));
+            OffloadConfig config;
+            config.selection_choices = choices;
+            manager.set_config(config);
+            manager.set_selection_seed(source);
+            EXPECT_TRUE(manager.auto_select_target_node());
+            picks[manager.get_current_target()->node_id]++;
+        }
+        return picks;
+    };
+
+    auto deterministic = run(0);
+    EXPECT_EQ(deterministic.size(), 1u);
+    EXPECT_EQ(deterministic["node0"], 200);             // Thundering herd
+
+    auto sampled = run(2);
+    int max_share = 0;
+    for (const auto& [node, count] : sampled) {
+        max_share = std::max(max_share, count);
+    }
+    EXPECT_GT(sampled.size(), 10u);
+    EXPECT_LT(max_share, 40);
+    EXPECT_EQ(sampled.count("node19"), 0u);              // Worst node never wins a pair
+}
+
+TEST(PowerOfChoicesSelectionTest, PrefersLocalRegionAndSkipsUnhealthy) {
+    MockOffloadManager manager;
+    auto nodes = cluster(6);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodes[i].region = i % 2 == 0 ? "eu-west-1" : "us-east-1";
+    }
+    nodes[0].health = NodeHealth::Unhealthy;
+    manager.set_available_nodes(nodes);
+    manager.set_local_location({"eu-west-1", "test-cluster", ""});
+    OffloadConfig config;
+    config.selection_choices = 6;                        // d >= n: exact best
+    manager.set_config(config);
+
+    ASSERT_TRUE(manager.auto_select_target_node());
+    EXPECT_EQ(manager.get_current_target()->node_id, "node2");
+}
@@ -0,0 +1,120 @@
+/**
+ * @file test_simulator.cpp
+ * @brief Unit Tests for the Offload Policy and Cluster Simulator
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include "../include/redcomponent/offloading/ClusterSimulator.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+namespace {
+
+// 1 GiB local memory: each 100MB mock offload relieves ~9.8%
+SimulationConfig small_host(double failure_rate = 0.0, uint64_t seed = 1) {
+    SimulationConfig config;
+    config.local_memory_bytes = 1024ULL * 1024 * 1024;
+    config.segment_failure_rate = failure_rate;
+    config.seed = seed;
+    return config;
+}
+
+void add_default_nodes(ClusterSimulator& sim) {
+    sim.add_node(MockOffloadManager::create_mock_node("fast", "10.0.0.1", 100ULL << 30),
+                 LinkMetrics{1ms, 1.0e9});
+    sim.add_node(MockOffloadManager::create_mock_node("slow", "10.0.0.2", 500ULL << 30),
+                 LinkMetrics{1ms, 1.0e8});
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Policy Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(OffloadPolicyTest, TriggerThresholdsAndBackoff) {
+    OffloadConfig config;
+    EXPECT_FALSE(OffloadPolicy::should_trigger({79.9, 10.0}, config));
+    EXPECT_TRUE(OffloadPolicy::should_trigger({80.0, 10.0}, config));
+    EXPECT_TRUE(OffloadPolicy::should_trigger({10.0, 85.0}, config));
+    config.auto_offload = false;
+    EXPECT_FALSE(OffloadPolicy::should_trigger({99.0, 99.0}, config));
+
+    EXPECT_EQ(OffloadPolicy::retry_delay(1, config), 1000ms);
+    EXPECT_EQ(OffloadPolicy::retry_delay(3, config), 4000ms);
+    EXPECT_EQ(OffloadPolicy::retry_delay(20, config), 300000ms);   // Capped at transfer_timeout
+    EXPECT_TRUE(OffloadPolicy::may_retry(2, config));
+    EXPECT_FALSE(OffloadPolicy::may_retry(3, config));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Simulator Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ClusterSimulatorTest, AutoTriggerRelievesLoadOnFastestNode) {
+    MockOffloadManager manager;
+    {
+        ClusterSimulator sim(manager, small_host());
+        add_default_nodes(sim);
+        sim.set_load_curve(LoadCurve::constant(90.0));
+
+        auto report = sim.run_for(1h);
+        EXPECT_EQ(report.offloads_triggered, 2u);       // 90% -> ~80.2% -> ~70.5%
+        EXPECT_EQ(report.offloads_succeeded, 2u);
+        EXPECT_EQ(report.bytes_per_node["fast"], 200u * 1024 * 1024);
+        EXPECT_LT(sim.memory_percent(), 80.0);
+        EXPECT_EQ(sim.nodes()[0].available_storage_bytes, (100ULL << 30) - 200 * 1024 * 1024);
+
+        // Virtual clock drives the mock's progress timestamps and rates
+        auto result = manager.get_last_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_GT(result->final_progress.average_bytes_per_second, 5.0e8);
+        EXPECT_LT(result->duration(), 1s);
+    }
+    EXPECT_EQ(manager.metrics().offloads_started.value(), 2u);
+}
+
+TEST(ClusterSimulatorTest, NodeOutageCausesRetriesAndFailover) {
+    MockOffloadManager manager;
+    ClusterSimulator sim(manager, small_host());
+    add_default_nodes(sim);
+    sim.set_load_curve(LoadCurve::constant(85.0));
+
+    // Fast node dies 50ms into the first offload, after selection
+    sim.fail_node(50ms, 2h, "fast");
+    auto report = sim.run_for(1h);
+
+    EXPECT_EQ(report.offloads_failed, 1u);
+    EXPECT_EQ(report.segment_retries, 3u);              // max_retries
+    EXPECT_EQ(report.segment_failures, 4u);
+    EXPECT_EQ(report.offloads_succeeded, 1u);           // Next trigger fails over
+    EXPECT_EQ(report.bytes_per_node["slow"], 100u * 1024 * 1024);
+    EXPECT_EQ(manager.metrics().segment_retries.value(), 3u);
+}
+
+TEST(ClusterSimulatorTest, SimulatesDaysDeterministically) {
+    auto run = [](uint64_t seed) {
+        MockOffloadManager manager;
+        ClusterSimulator sim(manager, small_host(0.01, seed));
+        add_default_nodes(sim);
+        // Daily peak reaching 95% plus 20%/day growth absorbed by offloads
+        sim.set_load_curve(LoadCurve::diurnal(70.0, 25.0).with_growth(20.0));
+        return sim.run_for(7 * 24h);
+    };
+
+    auto a = run(42);
+    auto b = run(42);
+    EXPECT_EQ(a.simulated, 7 * 24h);
+    EXPECT_EQ(a.samples, 7u * 24 * 360 + 1);         // Both ends inclusive
+    EXPECT_GT(a.offloads_succeeded, 10u);
+    EXPECT_GT(a.segment_retries, 0u);
+    EXPECT_EQ(a.offloads_succeeded, b.offloads_succeeded);
+    EXPECT_EQ(a.segment_retries, b.segment_retries);
+    EXPECT_EQ(a.bytes_offloaded, b.bytes_offloaded);
+    EXPECT_LE(a.peak_memory_percent, 85.0);
+}
@@ -0,0 +1,124 @@
+/**
+ * @file test_topology.cpp
+ * @brief Unit Tests for Topology-Aware Target Selection
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+
+#include "../include/redcomponent/offloading/Topology.hpp"
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+namespace {
+
+TargetNode make_node(const std::string& id, const std::string& region,
+                     const std::string& cluster, const std::string& zone,
+                     size_t available) {
+    auto node = MockOffloadManager::create_mock_node(id, "10.0.0.1", available);
+    node.region = region;
+    node.cluster_id = cluster;
+    node.zone = zone;
+    return node;
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Topology Model Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(TopologyModelTest, LocalityClassification) {
+    NodeLocation a{"eu-central-1", "c1", "rack-a"};
+
+    EXPECT_EQ(TopologyModel::locality(a, {"eu-central-1", "c1", "rack-a"}), Locality::SameZone);
+    EXPECT_EQ(TopologyModel::locality(a, {"eu-central-1", "c1", "rack-b"}), Locality::SameCluster);
+    EXPECT_EQ(TopologyModel::locality(a, {"eu-central-1", "c1", ""}), Locality::SameCluster);
+    EXPECT_EQ(TopologyModel::locality(a, {"eu-central-1", "c2", "rack-a"}), Locality::SameRegion);
+    EXPECT_EQ(TopologyModel::locality(a, {"us-east-1", "c1", "rack-a"}), Locality::CrossRegion);
+}
+
+TEST(TopologyModelTest, CrossRegionIsSlowerThanSameZone) {
+    TopologyModel model;
+    OffloadConfig config;
+    NodeLocation local{"eu-central-1", "c1", "rack-a"};
+
+    auto near = make_node("near", "eu-central-1", "c1", "rack-a", 1);
+    auto far = make_node("far", "us-east-1", "c9", "", 1);
+
+    size_t bytes = 1024ULL * 1024 * 1024;
+    auto near_time = model.expected_transfer_time(local, near, bytes, config);
+    auto far_time = model.expected_transfer_time(local, far, bytes, config);
+    EXPECT_GE(far_time, near_time * 10);
+}
+
+TEST(TopologyModelTest, MeasuredLinksOverrideDefaults) {
+    TopologyModel model;
+    NodeLocation local{"eu-central-1", "c1", ""};
+    auto remote = make_node("remote", "us-east-1", "c2", "", 1);
+
+    model.set_region_link("us-east-1", "eu-central-1", {80ms, 5.0e7});
+    EXPECT_EQ(model.link_to(local, remote).latency, 80ms);
+
+    model.set_node_link("remote", {1ms, 1.0e9});
+    EXPECT_EQ(model.link_to(local, remote).latency, 1ms);
+
+    model.clear_node_link("remote");
+    EXPECT_EQ(model.link_to(local, remote).latency, 80ms);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Selection Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(TopologySelectionTest, PrefersSameRackOverLargerRemoteNode) {
+    MockOffloadManager manager;
+    manager.set_available_nodes({
+        make_node("remote-big", "us-east-1", "c2", "", 500ULL << 30),
+        make_node("same-region", "eu-central-1", "c2", "", 100ULL << 30),
+        make_node("same-rack", "eu-central-1", "c1", "rack-a", 50ULL << 30),
+    });
+    manager.set_local_location({"eu-central-1", "c1", "rack-a"});
+
+    ASSERT_TRUE(manager.auto_select_target_node());
+    EXPECT_EQ(manager.get_current_target()->node_id, "same-rack");
+}
+
+TEST(TopologySelectionTest, FallsBackToRemoteRegion) {
+    MockOffloadManager manager;
+    auto local = make_node("local", "eu-central-1", "c1", "", 100ULL << 30);
+    local.health = NodeHealth::Unhealthy;
+    manager.set_available_nodes({
+        local,
+        make_node("remote", "us-east-1", "c2", "", 100ULL << 30),
+    });
+    manager.set_local_location({"eu-central-1", "c1", ""});
+
+    ASSERT_TRUE(manager.auto_select_target_node());
+    EXPECT_EQ(manager.get_current_target()->node_id, "remote");
+}
+
+TEST(TopologySelectionTest, FasterRemoteWinsWithoutRegionPreference) {
+    MockOffloadManager manager;
+    OffloadConfig config;
+    config.prefer_local_region = false;
+    manager.set_config(config);
+
+    auto local = make_node("local", "eu-central-1", "c1", "", 100ULL << 30);
+    local.network_utilization_percent = 95.0;
+    manager.set_available_nodes({
+        local,
+        make_node("remote", "eu-west-1", "c2", "", 100ULL << 30),
+    });
+    manager.set_local_location({"eu-central-1", "c1", ""});
+
+    TopologyModel model;
+    model.set_region_link("eu-central-1", "eu-west-1", {10ms, 1.0e9});
+    manager.set_topology(model);
+
+    ASSERT_TRUE(manager.auto_select_target_node());
+    EXPECT_EQ(manager.get_current_target()->node_id, "remote");
+}
@@ -0,0 +1,80 @@
+/**
+ * @file test_tracing.cpp
+ * @brief Unit Tests for Offload Lifecycle Tracing
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "../include/redcomponent/offloading/Tracing.hpp"
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Tracer Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(TracingTest, DisabledTracerRecordsNothing) {
+    Tracer tracer;
+    {
+        ScopedSpan span(tracer, SpanKind::SegmentRead, 1);
+    }
+    EXPECT_TRUE(tracer.collect().empty());
+}
+
+TEST(TracingTest, PerThreadRingsAreCollected) {
+    Tracer tracer;
+    tracer.set_enabled(true);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&tracer]() {
+            for (uint64_t i = 0; i < 100; ++i) {
+                ScopedSpan span(tracer, SpanKind::SegmentSend, i);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto events = tracer.collect();
+    EXPECT_EQ(events.size(), 400u);
+}
+
+TEST(TracingTest, RingKeepsNewestEvents) {
+    Tracer tracer;
+    tracer.set_enabled(true);
+    auto now = Tracer::Clock::now();
+    for (uint64_t i = 0; i < TraceRing::kCapacity + 10; ++i) {
+        tracer.record(SpanKind::SegmentRead, now, now + 1us, i);
+    }
+
+    auto events = tracer.collect();
+    ASSERT_EQ(events.size(), TraceRing::kCapacity);
+    EXPECT_EQ(events.front().segment_id, 10u);
+    EXPECT_EQ(events.back().segment_id, TraceRing::kCapacity + 9);
+}
+
+TEST(TracingTest, MockTracesLifecycleAsChromeJson) {
+    MockOffloadManager manager;
+    manager.tracer().set_enabled(true);
+
+    ASSERT_TRUE(manager.select_target_node("node1"));
+    ASSERT_TRUE(manager.start_offload());
+    manager.simulate_segment_timing(2ms, 0us, 500us);
+    manager.simulate_complete(true);
+
+    auto json = manager.tracer().dump_chrome_trace_json();
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+    for (const char* name : {"Preparing", "Transferring", "SegmentSend",
+                             "SegmentVerify", "Completing"}) {
+        EXPECT_NE(json.find(std::string("\"name\":\"") + name + "\""), std::string::npos) << name;
+    }
+    EXPECT_NE(json.find("\"dur\":2000.000"), std::string::npos);
+}
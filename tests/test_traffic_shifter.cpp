@@ -0,0 +1,120 @@
+/**
+ * @file test_traffic_shifter.cpp
+ * @brief Unit Tests for Gradual Endpoint/Proxy Traffic Shifting
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <string>
+
+#include "../include/redcomponent/offloading/TrafficShifter.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+namespace {
+
+// Local CPU with a fraction f of requests proxied (forwarding costs 5%)
+double local_cpu(double demand, double f) {
+    return demand * (1.0 - f) + 5.0 * f;
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Controller Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(TrafficShifterTest, ShedsJustEnoughLoadToHoldSetpoint) {
+    TrafficShifter shifter;
+    auto now = std::chrono::steady_clock::time_point{};
+    double f = 0.0;
+    double peak_after_settling = 0.0;
+    for (int second = 0; second < 120; ++second) {
+        double cpu = local_cpu(95.0, f);
+        if (second >= 30) peak_after_settling = std::max(peak_after_settling, cpu);
+        f = shifter.update({40.0, 50.0, cpu}, now);
+        now += 1s;
+    }
+    // (95 - 75) / (95 - 5) of the traffic, not all of it
+    EXPECT_NEAR(f, 20.0 / 90.0, 0.01);
+    EXPECT_NEAR(local_cpu(95.0, f), 75.0, 0.5);
+    EXPECT_LT(peak_after_settling, 76.0);
+}
+
+TEST(TrafficShifterTest, RestoresTrafficGraduallyWhenLoadDrops) {
+    TrafficShifterOptions options;
+    options.max_step = 0.05;
+    TrafficShifter shifter(options);
+    auto now = std::chrono::steady_clock::time_point{};
+    double f = 0.0;
+    for (int second = 0; second < 200; ++second) {
+        f = shifter.update({0.0, 0.0, local_cpu(120.0, f)}, now);
+        now += 1s;
+    }
+    ASSERT_NEAR(f, 45.0 / 115.0, 0.01);
+
+    // Demand falls below the setpoint: the fraction unwinds, never snaps to zero
+    double previous = f;
+    for (int second = 0; second < 200; ++second) {
+        f = shifter.update({0.0, 0.0, local_cpu(50.0, f)}, now);
+        EXPECT_LE(previous - f, 0.05 + 1e-9);
+        previous = f;
+        now += 1s;
+    }
+    EXPECT_EQ(f, 0.0);
+}
+
+TEST(TrafficShifterTest, DecisionsFollowFractionAndStickPerKey) {
+    TrafficShifter shifter;
+    auto now = std::chrono::steady_clock::time_point{};
+    for (int second = 0; second < 100; ++second) {
+        shifter.update({0.0, 0.0, local_cpu(95.0, shifter.fraction())}, now);
+        now += 1s;
+    }
+    double f = shifter.fraction();
+
+    int keyed = 0;
+    int keyless = 0;
+    for (int i = 0; i < 20000; ++i) {
+        std::string key = "key-" + std::to_string(i);
+        keyed += shifter.decide_mode(key) == ProtocolMode::Proxy;
+        EXPECT_EQ(shifter.decide_mode(key), shifter.decide_mode(key));
+        keyless += shifter.decide_mode() == ProtocolMode::Proxy;
+    }
+    EXPECT_NEAR(keyed / 20000.0, f, 0.02);
+    EXPECT_NEAR(keyless / 20000.0, f, 0.001);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Controller Mode Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(TrafficShifterTest, WeightedModeAvoidsBinaryOscillation) {
+    auto run = [](OffloadingController::ModePolicy policy) {
+        OffloadingController controller(policy);
+        auto now = std::chrono::steady_clock::time_point{};
+        int flips = 0;
+        double previous = 0.0;
+        for (int second = 0; second < 120; ++second) {
+            double f = controller.proxy_fraction();
+            controller.observe({0.0, 0.0, local_cpu(95.0, f)}, now);
+            if (second >= 30 && std::abs(controller.proxy_fraction() - previous) > 0.5) flips++;
+            previous = controller.proxy_fraction();
+            now += 1s;
+        }
+        return flips;
+    };
+
+    EXPECT_GT(run(OffloadingController::ModePolicy::Binary), 80);    // Flaps every sample
+    EXPECT_EQ(run(OffloadingController::ModePolicy::Weighted), 0);
+
+    OffloadingController binary(OffloadingController::ModePolicy::Binary);
+    binary.observe({0.0, 0.0, 90.0}, {});
+    EXPECT_EQ(binary.decide_mode("k"), ProtocolMode::Proxy);
+    binary.observe({0.0, 0.0, 10.0}, {});
+    EXPECT_EQ(binary.decide_mode("k"), ProtocolMode::Endpoint);
+}
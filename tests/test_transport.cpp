@@ -0,0 +1,145 @@
+/**
+ * @file test_transport.cpp
+ * @brief Unit Tests for the Loopback and Fault-Injecting Transports
+ * @copyright Copyright (c) 2026 BEP Venture UG. All rights reserved.
+ * @license EULA - Proprietary
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+
+#include "../include/redcomponent/offloading/FaultInjectingTransport.hpp"
+#include "../include/redcomponent/offloading/MockOffloadManager.hpp"
+
+using namespace redcomponent::offloading;
+using namespace std::chrono_literals;
+
+namespace {
+
+std::vector<std::byte> make_payload(size_t size, uint8_t seed) {
+    std::vector<std::byte> payload(size);
+    for (size_t i = 0; i < size; ++i) {
+        payload[i] = static_cast<std::byte>((i * 31 + seed) & 0xFF);
+    }
+    return payload;
+}
+
+TargetNode loopback_node() {
+    return MockOffloadManager::create_mock_node("loopback", "127.0.0.1", 1ULL << 30);
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Loopback Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(LoopbackTransportTest, DeliversAndVerifiesSegments) {
+    LoopbackTarget target;
+    LoopbackTransport transport(target);
+    auto payload = make_payload(4096, 7);
+
+    EXPECT_EQ(transport.send_segment(0, payload, crc32c(payload)), TransportStatus::NotConnected);
+    ASSERT_TRUE(transport.connect(loopback_node()));
+    EXPECT_EQ(transport.send_segment(0, payload, crc32c(payload)), TransportStatus::Ok);
+    EXPECT_EQ(transport.send_segment(1, payload, crc32c(payload) ^ 1),
+              TransportStatus::ChecksumMismatch);
+
+    EXPECT_EQ(target.segment_count(), 1u);
+    EXPECT_EQ(target.rejected_count(), 1u);
+    EXPECT_EQ(target.segment(0), payload);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Fault Injection Tests
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(FaultInjectingTransportTest, LatencyAndBandwidthCapDelaySegments) {
+    LoopbackTarget target;
+    LoopbackTransport loopback(target);
+    std::chrono::microseconds slept{0};
+    FaultProfile profile;
+    profile.latency = 2ms;
+    profile.bandwidth_bytes_per_second = 1.0e6;
+    FaultInjectingTransport transport(loopback, profile, 1,
+                                      [&](std::chrono::microseconds d) { slept += d; });
+
+    ASSERT_TRUE(transport.connect(loopback_node()));
+    auto payload = make_payload(10000, 1);
+    EXPECT_EQ(transport.send_segment(0, payload, crc32c(payload)), TransportStatus::Ok);
+
+    EXPECT_EQ(slept, 2ms + 2ms + 10ms);     // Connect RTT, send RTT, 10KB at 1MB/s
+    EXPECT_EQ(transport.stats().injected_delay, slept);
+    EXPECT_EQ(transport.stats().delivered_bytes, 10000u);
+}
+
+TEST(FaultInjectingTransportTest, InjectsResetsCorruptionAndTimeouts) {
+    LoopbackTarget target;
+    LoopbackTransport loopback(target);
+    FaultProfile profile;
+    profile.reset_probability = 1.0;
+    FaultInjectingTransport transport(loopback, profile, 1, [](std::chrono::microseconds) {});
+    auto payload = make_payload(512, 3);
+    uint32_t crc = crc32c(payload);
+
+    ASSERT_TRUE(transport.connect(loopback_node()));
+    EXPECT_EQ(transport.send_segment(0, payload, crc), TransportStatus::ConnectionReset);
+    EXPECT_FALSE(transport.is_connected());
+
+    profile = FaultProfile{};
+    profile.corruption_probability = 1.0;
+    transport.set_profile(profile);
+    ASSERT_TRUE(transport.connect(loopback_node()));
+    EXPECT_EQ(transport.send_segment(0, payload, crc), TransportStatus::ChecksumMismatch);
+    EXPECT_EQ(target.rejected_count(), 1u);
+
+    profile = FaultProfile{};
+    profile.stall_probability = 1.0;
+    profile.stall_duration = 5s;
+    profile.ack_timeout = 1s;
+    transport.set_profile(profile);
+    EXPECT_EQ(transport.send_segment(0, payload, crc), TransportStatus::Timeout);
+
+    EXPECT_EQ(transport.stats().resets, 1u);
+    EXPECT_EQ(transport.stats().corruptions, 1u);
+    EXPECT_EQ(transport.stats().timeouts, 1u);
+    EXPECT_EQ(target.segment_count(), 0u);
+}
+
+TEST(FaultInjectingTransportTest, GoodputUnderOnePercentSegmentFailure) {
+    // 1000 x 64KB segments over a 100 MB/s, 1ms link in virtual time
+    constexpr size_t kSegments = 1000;
+    constexpr size_t kSegmentSize = 64 * 1024;
+    OffloadConfig config;
+    config.retry_delay = 2ms;
+
+    auto run = [&](double failure_rate) {
+        LoopbackTarget target;
+        LoopbackTransport loopback(target);
+        std::chrono::microseconds clock{0};
+        SleepFunction sleep = [&clock](std::chrono::microseconds d) { clock += d; };
+        FaultProfile profile = FaultProfile::segment_failures(failure_rate);
+        profile.latency = 1ms;
+        profile.bandwidth_bytes_per_second = 1.0e8;
+        FaultInjectingTransport transport(loopback, profile, 42, sleep);
+
+        auto payload = make_payload(kSegmentSize, 9);
+        uint32_t crc = crc32c(payload);
+        size_t failed = 0;
+        for (uint64_t id = 0; id < kSegments; ++id) {
+            auto outcome = send_with_retry(transport, loopback_node(), id, payload, crc,
+                                           config, sleep);
+            if (outcome.status != TransportStatus::Ok) failed++;
+        }
+        EXPECT_EQ(failed, 0u);
+        EXPECT_EQ(target.segment_count(), kSegments);
+        return static_cast<double>(kSegments * kSegmentSize) / (clock.count() / 1e6);
+    };
+
+    double clean = run(0.0);
+    double faulty = run(0.01);
+    double retained = faulty / clean;
+    EXPECT_GT(retained, 0.95);
+    EXPECT_LT(retained, 1.0);
+}